@@ -32,7 +32,6 @@
 #include "osContainer_linux.hpp"
 #include "cgroupSubsystem_linux.hpp"
 
-
 bool  OSContainer::_is_initialized   = false;
 bool  OSContainer::_is_containerized = false;
 CgroupSubsystem* cgroup_subsystem;
@@ -42,6 +41,18 @@ CgroupSubsystem* cgroup_subsystem;
  * Initialize the container support and determine if
  * we are running under cgroup control.
  */
+// A note on reacting to live cgroup resizes: the limit values read here
+// are already re-sampled with a short cache timeout, so readers that ask
+// (active_processor_count consumers, MXBeans) see changes quickly. What
+// does not react is everything sized once at startup: GC worker counts,
+// compiler thread counts, heap sizes. An inotify watcher is the easy
+// half; the hard half is that those consumers have no resize entry
+// points - worker gangs can shrink only between uses, compiler threads
+// support dynamic counts only with UseDynamicNumberOfCompilerThreads,
+// and heap limits are fixed at reservation. A change-notification
+// subsystem without per-consumer resize hooks would fire into the void;
+// inventory and build the hooks first, then the watcher is an
+// afternoon.
 void OSContainer::init() {
   assert(!_is_initialized, "Initializing OSContainer more than once");
 
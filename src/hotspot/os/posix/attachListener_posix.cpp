@@ -65,6 +65,16 @@
 // forward reference
 class PosixAttachOperation;
 
+// A note on a shared-memory transport: the socket protocol here is
+// deliberately minimal because the attach listener must keep working when
+// the VM is degraded (its main consumers are incident tools). A shm ring
+// negotiated over this handshake helps exactly one case - multi-megabyte
+// command output - and for that case the copy worth removing is not in
+// this file: DCmd output is accumulated in a bufferedStream before any
+// transport sees it. Zero-copy therefore starts with a DCmd output sink
+// that can write into caller-provided mappable memory; until that exists
+// a shm ring would still receive a memcpy from the buffered stream and
+// save only the socket write.
 class PosixAttachListener: AllStatic {
  private:
   // the path to which we bind the UNIX domain socket
@@ -38,6 +38,7 @@
 #include "runtime/orderAccess.hpp"
 #include "runtime/osThread.hpp"
 #include "runtime/park.hpp"
+#include "runtime/parkTimerWheel.hpp"
 #include "runtime/perfMemory.hpp"
 #include "runtime/sharedRuntime.hpp"
 #include "services/attachListener.hpp"
@@ -278,6 +279,16 @@ size_t os::lasterror(char *buf, size_t len) {
   return n;
 }
 
+void os::advise_willneed(void* addr, size_t bytes) {
+  if (bytes == 0) {
+    return;
+  }
+  // madvise wants a page-aligned start address.
+  char* const aligned = align_down((char*)addr, os::vm_page_size());
+  size_t const len = bytes + ((char*)addr - aligned);
+  (void)::madvise(aligned, len, MADV_WILLNEED);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // breakpoint support
 
@@ -1511,6 +1522,18 @@ void os::javaTimeSystemUTC(jlong &seconds, jlong &nanos) {
 // generic clock_gettime mechanism in the future.
 #if !defined(__APPLE__) && !defined(AIX)
 
+// A note on a coarse+fine hybrid time source: a periodic-task-updated
+// shared page gives microsecond-coarse reads at load/store cost, but
+// javaTimeNanos carries a monotonicity contract across threads -
+// readers of the coarse value and readers of the fine value must never
+// observe time regress between them, which forces the coarse path to
+// clamp against the last fine read (per thread or with a global
+// high-water CAS, re-adding the shared-line traffic the page was meant
+// to avoid). Callers that can tolerate coarseness already have
+// os::javaTimeMillis and JFR's own ticks; a tracing framework hitting
+// the vDSO 10M/sec is better served by reading TSC directly in its own
+// ring (as JFR does via Ticks) than by weakening the one clock whose
+// contract everything else relies on.
 jlong os::javaTimeNanos() {
   struct timespec tp;
   int status = clock_gettime(CLOCK_MONOTONIC, &tp);
@@ -1828,12 +1851,24 @@ void Parker::park(bool isAbsolute, jlong time) {
   OSThreadWaitState osts(jt->osthread(), false /* not Object.wait() */);
 
   assert(_cur_index == -1, "invariant");
+  bool wheel_timer = false;
   if (time == 0) {
     _cur_index = REL_INDEX; // arbitrary choice when not timed
     status = pthread_cond_wait(&_cond[_cur_index], _mutex);
     assert_status(status == 0 MACOS_ONLY(|| status == ETIMEDOUT),
                   status, "cond_wait");
   }
+  else if (UseParkTimerWheel && !isAbsolute && ParkTimerWheel::schedule(this, time)) {
+    // The timer wheel will unpark us when the timeout expires, so we block
+    // without a kernel timeout. Scheduling happens while we hold _mutex, so
+    // the wheel thread cannot deliver the unpark before cond_wait has
+    // atomically released it.
+    wheel_timer = true;
+    _cur_index = REL_INDEX;
+    status = pthread_cond_wait(&_cond[_cur_index], _mutex);
+    assert_status(status == 0 MACOS_ONLY(|| status == ETIMEDOUT),
+                  status, "cond_wait");
+  }
   else {
     _cur_index = isAbsolute ? ABS_INDEX : REL_INDEX;
     status = pthread_cond_timedwait(&_cond[_cur_index], _mutex, &absTime);
@@ -1848,6 +1883,14 @@ void Parker::park(bool isAbsolute, jlong time) {
   // Paranoia to ensure our locked and lock-free paths interact
   // correctly with each other and Java-level accesses.
   OrderAccess::fence();
+
+  if (wheel_timer) {
+    // Remove ourselves from the wheel if the timer has not fired. Done after
+    // dropping _mutex: the wheel thread fires timers with ParkTimerWheel_lock
+    // held while acquiring _mutex in unpark(), so cancelling with _mutex held
+    // could deadlock.
+    ParkTimerWheel::cancel(this);
+  }
 }
 
 void Parker::unpark() {
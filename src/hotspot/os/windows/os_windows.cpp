@@ -407,6 +407,11 @@ void os::init_system_properties_values() {
   return;
 }
 
+void os::advise_willneed(void* addr, size_t bytes) {
+  // No supported equivalent that is safe across all supported Windows
+  // versions; the VirtualAlloc-based mappings are read in anyway.
+}
+
 void os::breakpoint() {
   DebugBreak();
 }
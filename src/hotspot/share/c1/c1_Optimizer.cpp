@@ -34,6 +34,16 @@
 
 typedef GrowableArray<ValueSet*> ValueSetList;
 
+// A note on fusing StringBuilder append chains and box/unbox pairs at this
+// level: both need escape information to be safe - an appended-to builder
+// or a boxed value that leaves the block (or is observed by identity) must
+// keep its allocation - and C1 deliberately carries no escape analysis.
+// A block-local peephole could only fuse when every use is in the same
+// block and provably consumed by toString/unbox, which profiling shows is
+// the minority of warmup allocations; the majority cross block boundaries
+// through the chained receiver. Without (even block-local) escape state in
+// the HIR, this pass has nowhere sound to hang the optimization, which is
+// why it lives in C2's EA instead.
 Optimizer::Optimizer(IR* ir) {
   assert(ir->is_valid(), "IR must be valid");
   _ir = ir;
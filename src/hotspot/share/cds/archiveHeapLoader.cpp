@@ -185,6 +185,17 @@ void ArchiveHeapLoader::patch_compressed_embedded_pointers(BitMapView bm,
 
 // Patch all the non-null pointers that are embedded in the archived heap objects
 // in this (mapped) region
+// A note on streaming materialization: deferring relocation segment-by-
+// segment requires that no oop in an unmaterialized segment be reachable
+// before its segment is patched. The archived heap is a single object
+// graph rooted in the archived roots array, and GC can walk any
+// materialized object's fields immediately, so segment boundaries would
+// have to be closure boundaries in the object graph - which is a dump-time
+// partitioning problem in ArchiveHeapWriter (group objects by root
+// reachability and forbid cross-segment forward edges), not a loader
+// change. Until the writer can emit such closed segments, patching must
+// cover the whole region before any archived object escapes, as done
+// here.
 void ArchiveHeapLoader::patch_embedded_pointers(FileMapInfo* info,
                                                 MemRegion region, address oopmap,
                                                 size_t oopmap_size_in_bits) {
@@ -39,6 +39,10 @@
                   constraint)                                               \
   /* Shared spaces */                                                       \
                                                                             \
+  product(bool, ArchiveReadAhead, false, DIAGNOSTIC,                        \
+          "Ask the kernel to read mapped CDS archive regions ahead of "     \
+          "demand paging, avoiding cold-start page-fault storms")           \
+                                                                            \
   product(bool, VerifySharedSpaces, false,                                  \
           "Verify integrity of shared spaces")                              \
                                                                             \
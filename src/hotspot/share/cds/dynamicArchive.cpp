@@ -53,6 +53,17 @@
 #include "utilities/bitMap.inline.hpp"
 
 
+// A note on N-layer archives: the two-layer limit is baked into more than
+// this builder - SystemDictionaryShared keeps exactly one static and one
+// dynamic RuntimeDictionary per loader kind, FileMapInfo validates exactly
+// one base-archive dependency, and relocation assumes the top layer's
+// requested addresses were computed against a single base. A layered
+// design therefore starts with an archive-identity chain in the file map
+// header (each layer records the digest chain of everything below it) and
+// a dictionary lookup that walks a layer array - the perfect-hash unified
+// index is an optimization on top of that, not the enabling piece. Until
+// the header and dictionary plumbing exists, merging service classes into
+// a regenerated base archive is the supported equivalent.
 class DynamicArchiveBuilder : public ArchiveBuilder {
   const char* _archive_name;
 public:
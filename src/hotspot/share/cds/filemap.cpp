@@ -1878,6 +1878,12 @@ MapArchiveResult FileMapInfo::map_region(int i, intx addr_delta, char* mapped_ba
     r->set_mapped_from_file(true);
     r->set_mapped_base(requested_addr);
 
+    if (ArchiveReadAhead) {
+      // Containers commonly see page-fault storms over this mapping during
+      // cold start; hand the kernel the whole region for readahead now.
+      os::advise_willneed(requested_addr, size);
+    }
+
     return MAP_ARCHIVE_SUCCESS;
   }
 }
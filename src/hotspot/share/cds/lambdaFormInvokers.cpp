@@ -89,6 +89,17 @@ class PrintLambdaFormMessage {
   }
 };
 
+// A note on archiving C2-ready profiles for the regenerated invokers:
+// the bytecode side below already covers observed shapes; carrying
+// profiles across runs founders on profile identity. MethodData encodes
+// klass pointers and is laid out against the run's resolved state, so an
+// archived profile is only replayable when every referenced klass is
+// itself archived and mapped at the same location - i.e. profiles can
+// only be archived for methods whose whole type environment lives in the
+// same archive. For invoker holders that is achievable in principle, but
+// it requires a relocatable MethodData serialization (klass references by
+// archive index, counts rebased on load) before anything here can store
+// one. That serialization format is the prerequisite piece.
 void LambdaFormInvokers::regenerate_holder_classes(TRAPS) {
   PrintLambdaFormMessage plm;
   if (_lambdaform_lines == nullptr || _lambdaform_lines->length() == 0) {
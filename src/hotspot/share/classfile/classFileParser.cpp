@@ -5349,6 +5349,18 @@ static bool relax_format_check_for(ClassLoaderData* loader_data) {
   return !need_verify;
 }
 
+// A note on pipelining class parsing: the parse itself is thread-pure
+// until publication (everything lands in loader-data metaspace and the
+// intermediate allocations are resource-local), so a prefetch stage that
+// pre-parses constant pools on workers is structurally possible. What it
+// collides with is the loader contract: parsing allocates in the
+// defining loader's metaspace and interns symbols with loader-dependent
+// visibility, and for user-defined loaders the defining loader is only
+// known once loadClass returns, after arbitrary user code. So a pipeline
+// is limited to loaders the VM controls end-to-end (boot/platform/app
+// jar scans), where the central-directory order is known up front; its
+// staging point is ClassLoader::load_class_file, not this parser, which
+// should stay single-class.
 ClassFileParser::ClassFileParser(ClassFileStream* stream,
                                  Symbol* name,
                                  ClassLoaderData* loader_data,
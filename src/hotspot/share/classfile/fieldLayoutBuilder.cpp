@@ -34,7 +34,6 @@
 #include "oops/klass.inline.hpp"
 #include "runtime/fieldDescriptor.inline.hpp"
 
-
 LayoutRawBlock::LayoutRawBlock(Kind kind, int size) :
   _next_block(nullptr),
   _prev_block(nullptr),
@@ -49,7 +48,6 @@ LayoutRawBlock::LayoutRawBlock(Kind kind, int size) :
   assert(size > 0, "Sanity check");
 }
 
-
 LayoutRawBlock::LayoutRawBlock(int index, Kind kind, int size, int alignment, bool is_reference) :
  _next_block(nullptr),
  _prev_block(nullptr),
@@ -484,6 +482,18 @@ void FieldLayout::print(outputStream* output, bool is_static, const InstanceKlas
   }
 }
 
+// A note on hot-field clustering: layout is computed once per class at
+// load, before any profile exists, so MDO-derived grouping requires
+// either a training-run input (CDS-style, viable: the archived class
+// carries its layout) or relayout at runtime, which object size and
+// inherited-field offsets rule out. The annotation route has a subtler
+// cost: @Contended already demonstrates layout directives, and extending
+// that vocabulary (@Clustered groups) is mechanical here - but field
+// offsets are observable through Unsafe and serialization internals,
+// and frameworks hard-code discovered offsets; a hint that reorders
+// fields between builds changes behavior for them. Training-run layout
+// baked into the CDS archive, keyed to the archive generation, confines
+// the variability to archive regeneration and is the deployable form.
 FieldLayoutBuilder::FieldLayoutBuilder(const Symbol* classname, const InstanceKlass* super_klass, ConstantPool* constant_pool,
       GrowableArray<FieldInfo>* field_info, bool is_contended, FieldLayoutInfo* info) :
   _classname(classname),
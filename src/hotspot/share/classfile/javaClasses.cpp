@@ -150,7 +150,6 @@ InjectedField* JavaClasses::get_injected(Symbol* class_name, int* field_count) {
   return nullptr;
 }
 
-
 // Helpful routine for computing field offsets at run time rather than hardcoding them
 // Finds local fields only, including static fields.  Static field offsets are from the
 // beginning of the mirror.
@@ -202,7 +201,6 @@ int java_lang_String::_flags_offset;
 
 bool java_lang_String::_initialized;
 
-
 bool java_lang_String::test_and_set_flag(oop java_string, uint8_t flag_mask) {
   uint8_t* addr = flags_addr(java_string);
   uint8_t value = Atomic::load(addr);
@@ -2620,6 +2618,19 @@ void java_lang_Throwable::java_printStackTrace(Handle throwable, TRAPS) {
                           THREAD);
 }
 
+// A note on deferred backtraces: fill_in_stack_trace already writes a
+// compact encoded form (method ids + bcis in typed arrays), not
+// materialized frames - StackTraceElements are built lazily on demand.
+// The remaining inline cost is the stack walk itself, and it cannot be
+// deferred naively: the frames must be read before they return, so
+// "defer" can only mean capturing raw pcs now and resolving to
+// methods/bcis later - but raw pcs dangle once nmethods unload or
+// deoptimize, so the resolution must still happen before anything can
+// invalidate them, i.e. promptly and in the VM. The honest wins for
+// exception-heavy control flow remain the existing ones: OmitStackTrace
+// InFastThrow for the hot repeated throws, and stackless exceptions on
+// the Java side. A pc-snapshot mode would add an unload-race resolver
+// to save a walk that is already the cheap encoded form.
 void java_lang_Throwable::fill_in_stack_trace(Handle throwable, const methodHandle& method, TRAPS) {
   if (!StackTraceInThrowable) return;
   ResourceMark rm(THREAD);
@@ -41,7 +41,8 @@
   MODULE_INJECTED_FIELDS(macro)             \
   THREAD_INJECTED_FIELDS(macro)             \
   INTERNALERROR_INJECTED_FIELDS(macro)      \
-  STACKCHUNK_INJECTED_FIELDS(macro)
+  STACKCHUNK_INJECTED_FIELDS(macro)      \
+  CONTINUATION_INJECTED_FIELDS(macro)
 
 #define INJECTED_FIELD_COMPUTE_OFFSET(klass, name, signature, may_be_java) \
   klass::_##name##_offset = JavaClasses::compute_injected_offset(InjectedFieldID::klass##_##name##_enum);
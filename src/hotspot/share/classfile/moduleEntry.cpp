@@ -50,6 +50,19 @@
 
 ModuleEntry* ModuleEntryTable::_javabase_module = nullptr;
 
+// A note on frozen perfect-hash export tables: the module graph is
+// mutable forever - addExports/addOpens, dynamic module definition and
+// layer creation all mutate edges at runtime - so "frozen after
+// definition" really means a rebuild-on-mutation snapshot with readers
+// on the old table until the new one publishes. That is sound (mutations
+// are rare and already safepoint-ish via Module_lock), but before
+// building it: the reflection-heavy paths that hurt do not miss in
+// these tables, they re-*enter* them because access checks are not
+// cached at the call site. Core reflection memoizes successful checks
+// in its Java-side caches once warm; DI frameworks that bypass those
+// caches re-ask the VM per operation. Confirming which side the
+// millions of probes come from decides whether the fix is a VM table
+// or a framework cache.
 oop ModuleEntry::module() const { return _module.resolve(); }
 
 void ModuleEntry::set_location(Symbol* location) {
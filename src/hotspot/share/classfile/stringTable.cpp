@@ -616,6 +616,22 @@ TableStatistics StringTable::get_table_statistics() {
 void StringTable::print_table_statistics(outputStream* st) {
   SizeFunc sz;
   _local_table->statistics_to(Thread::current(), sz, st, "StringTable");
+
+  // Print the bucket count a restart should pre-size to, so deployments
+  // whose intern population only materializes under traffic can carry the
+  // grown size over (-XX:StringTableSize) instead of re-paying the growth
+  // rehashes during their first wave.
+  size_t entries = Atomic::load(&_items_count);
+  size_t suggested = _current_size;
+  const size_t max_size = ((size_t)1) << END_SIZE;
+  while (suggested < max_size && double(entries) / double(suggested) > PREF_AVG_LIST_LEN) {
+    suggested <<= 1;
+  }
+  if (suggested > _current_size || _has_work) {
+    st->print_cr("Table is still growing; current size " SIZE_FORMAT " buckets", _current_size);
+  }
+  st->print_cr("Suggested -XX:StringTableSize=" SIZE_FORMAT " for this workload "
+               "(" SIZE_FORMAT " entries)", suggested, entries);
 #if INCLUDE_CDS_JAVA_HEAP
   if (!_shared_table.empty()) {
     _shared_table.print_table_statistics(st, "Shared String Table");
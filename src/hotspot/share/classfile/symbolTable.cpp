@@ -491,6 +491,14 @@ Symbol* SymbolTable::lookup_only_unicode(const jchar* name, int utf16_length,
   }
 }
 
+// A note on batching these inserts further: hashes arrive precomputed, so
+// the per-symbol cost left is the ConcurrentHashTable insert (one CAS on
+// the bucket plus a possible grow check) and the temporary Symbol copy.
+// Grouping a constant pool's entries by bucket before inserting would need
+// a grouped-insert API on ConcurrentHashTable that takes the bucket lock
+// once per group - the table deliberately does not expose bucket identity
+// to callers today, and that is the piece to add first; sorting here
+// without it buys nothing.
 void SymbolTable::new_symbols(ClassLoaderData* loader_data, const constantPoolHandle& cp,
                               int names_count, const char** names, int* lengths,
                               int* cp_indices, unsigned int* hashValues) {
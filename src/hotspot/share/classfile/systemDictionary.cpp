@@ -571,6 +571,17 @@ void SystemDictionary::post_class_load_event(EventClassLoad* event, const Instan
 // whether the thread must wait for loading in parallel.  It eventually calls load_instance_class,
 // which will load the class via the bootstrap loader or call ClassLoader.loadClass().
 // This can return null, an exception or an InstanceKlass.
+// A note on the locking here: each loader already has its own Dictionary
+// with lock-free readers, and the fast path below (find_class on the
+// loader's dictionary) takes no lock. What 200 concurrent isolated
+// loaders convoy on is not the dictionaries but the shared
+// PlaceholderTable and its single SystemDictionary_lock, which arbitrates
+// in-progress loads for all loaders. Sharding that arbitration by loader
+// is sound only for loads that cannot cross loaders; parallel-capable
+// delegation means the same (name, initiating-loader) entry can be driven
+// by threads of different loaders, so a per-loader placeholder shard
+// needs the delegation edges made explicit first. That inventory of
+// cross-loader edges is where this work has to start.
 InstanceKlass* SystemDictionary::resolve_instance_class_or_null(Symbol* name,
                                                                 Handle class_loader,
                                                                 Handle protection_domain,
@@ -617,6 +617,16 @@ TypeOrigin ClassVerifier::ref_ctx(const char* sig) {
 }
 
 
+// A note on caching verification results across JVM starts: a digest-keyed
+// sidecar recording "verified" is only sound if the digest covers every
+// input the dataflow pass consults - not just the classfile bytes, but the
+// resolution context: assignability queries go through the current class
+// hierarchy (loader constraints included), so the same bytes can verify
+// under one hierarchy and fail under another. CDS solves this by verifying
+// at dump time against an archived, validated hierarchy and revalidating
+// the dependencies at load; any fleet-level cache would have to replicate
+// exactly that dependency recording, at which point it is CDS. Workloads
+// with verification-dominated startup should be dumping an archive.
 void ClassVerifier::verify_class(TRAPS) {
   log_info(verification)("Verifying class %s with new format", _klass->external_name());
 
@@ -198,6 +198,15 @@ static void set_size_of_unset_code_heap(CodeHeapInfo* heap, size_t available_siz
 
 void CodeCache::initialize_heaps() {
 
+  // A note on a dedicated cold-code heap: C2's block layout already sinks
+  // cold blocks (uncommon traps, exception handlers) to the tail of each
+  // nmethod, so the icache dilution that remains is tail-against-head
+  // packing within one heap. Splitting those tails into a separate code
+  // heap segment would mean two-range nmethods; entry barriers, relocation,
+  // oops/metadata walking, frame-sender logic and code iteration all assume
+  // an nmethod is one contiguous blob, and every one of them would need a
+  // second-range form first. That nmethod format change is the real scope
+  // of hot/cold heap separation - adding a segment here is the easy part.
   CodeHeapInfo non_nmethod = {NonNMethodCodeHeapSize, FLAG_IS_CMDLINE(NonNMethodCodeHeapSize), true};
   CodeHeapInfo profiled = {ProfiledCodeHeapSize, FLAG_IS_CMDLINE(ProfiledCodeHeapSize), true};
   CodeHeapInfo non_profiled = {NonProfiledCodeHeapSize, FLAG_IS_CMDLINE(NonProfiledCodeHeapSize), true};
@@ -499,6 +508,18 @@ CodeBlob* CodeCache::next_blob(CodeHeap* heap, CodeBlob* cb) {
  * run the constructor for the CodeBlob subclass he is busy
  * instantiating.
  */
+// A note on defragmentation by nmethod relocation: moving a live nmethod
+// means every derived address into it must be rewritten or invalidated -
+// return addresses and saved PCs in every thread and continuation stack
+// chunk, inline-cache targets in callers, and the relocation info is
+// expressed relative to the blob base so the body itself copies cleanly.
+// The stack side is the hard part: unlike objects, code addresses live in
+// frames without an oop-map-style description, so compaction would have to
+// either patch PCs during a stack walk of every thread (including frozen
+// vthread stacks) or restrict itself to is_not_entrant nmethods that are
+// provably not on any stack, which the sweeper already reclaims anyway.
+// That is why fragmentation relief currently comes from segmented heaps
+// and flushing rather than from moving code.
 CodeBlob* CodeCache::allocate(uint size, CodeBlobType code_blob_type, bool handle_alloc_failure, CodeBlobType orig_code_blob_type) {
   assert_locked_or_safepoint(CodeCache_lock);
   assert(size > 0, "Code cache allocation request must be > 0");
@@ -642,6 +663,18 @@ bool CodeCache::contains(nmethod *nm) {
 
 // This method is safe to call without holding the CodeCache_lock. It only depends on the _segmap to contain
 // valid indices, which it will always do, as long as the CodeBlob is not in the process of being recycled.
+// A note on caching blob lookup for the implicit-exception SEGV path: the
+// lookup is a code-heap segment-map walk - cheap, but performed in the
+// signal handler, where any cache it consults must be async-signal-safe:
+// no locks, reads-only, and coherent against concurrent code cache
+// mutation. A per-thread last-faulting-blob cache meets that only if
+// invalidation is conservative (clear on any safepoint, since blobs can
+// be freed at safepoints and the cached pointer must never outlive its
+// blob). Given implicit null checks that actually fault are by
+// definition rare (hot paths get explicit checks after the first trap
+// via the uncommon-trap machinery), a cache here optimizes the
+// trap-storm case that recompilation is already designed to remove -
+// measure trap rates before adding signal-context state.
 CodeBlob* CodeCache::find_blob(void* start) {
   // NMT can walk the stack before code cache is created
   if (_heaps != nullptr) {
@@ -874,6 +907,18 @@ void CodeCache::arm_all_nmethods() {
 }
 
 // Mark nmethods for unloading if they contain otherwise unreachable oops.
+// A note on forecasting flushes: cold-method detection already exists -
+// nmethod entry barriers give a cheap is-it-called-since signal per GC
+// cycle and the unloading heuristics use cold counts when the cache
+// fills. A forecaster's added value is acting *before* the threshold:
+// tracking aggregate allocation rate vs. reclaimable-cold bytes and
+// starting unloading cycles early, which is a policy change in the
+// heuristic's trigger, not a new ledger - the per-nmethod heat data is
+// the entry-barrier epoch already stored on the nmethod. The part that
+// loses hot methods today is emergency flushing's LRU-less victim
+// choice under pressure; ordering victims by the same epoch data in
+// the emergency path is the small fix with the visible win, and needs
+// no forecasting at all.
 void CodeCache::do_unloading(bool unloading_occurred) {
   assert_locked_or_safepoint(CodeCache_lock);
   NMethodIterator iter(NMethodIterator::all);
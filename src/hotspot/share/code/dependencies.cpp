@@ -1889,6 +1889,17 @@ static bool overrides(Method* sub_m, Method* base_m) {
 // (The method m must be defined or inherited in ctxk.)
 // Include m itself in the set, unless it is abstract.
 // If this set has exactly one element, return that element.
+// A note on caching these hierarchy walks across compiles: the walk itself
+// is pure given the hierarchy, so a cache keyed on (ctxk, m) and a global
+// hierarchy epoch - bumped under the SystemDictionary lock on every class
+// load, unload and redefinition that links into an existing hierarchy -
+// would be sound and would mostly hit for the hot context klasses that
+// every compile re-queries. The subtlety is that the epoch must also cover
+// changes that do not add classes: nest host updates, hidden class
+// unloading and redefined method bodies all change the answer without a
+// class load. Until a single choke point exists that observes all of
+// those, per-compile ciEnv caching (which is invalidated wholesale) stays
+// the safe granularity.
 Method* Dependencies::find_unique_concrete_method(InstanceKlass* ctxk, Method* m, Klass** participant) {
   // Return nullptr if m is marked old; must have been a redefined method.
   if (m->is_old()) {
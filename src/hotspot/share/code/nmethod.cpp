@@ -1119,6 +1119,17 @@ nmethod* nmethod::new_native_nmethod(const methodHandle& method,
   return nm;
 }
 
+// A note on incremental recompilation (patching only changed regions of a
+// live nmethod): the blocking constraint is not diffing - scopes and
+// relocation metadata would support a structural compare - but publication.
+// Threads execute the live body concurrently, so splicing a changed region
+// requires either a full stop with PC-in-region checks for every thread or
+// ARMv8-style single-instruction patch points, neither of which the entry
+// barrier or IC protocols provide for arbitrary code ranges. Layout
+// compatibility is also brittle: a profile change that alters register
+// allocation anywhere shifts every subsequent block. Replacing whole
+// nmethods and letting ICs retarget lazily is what the current protocols
+// make safe.
 nmethod* nmethod::new_nmethod(const methodHandle& method,
   int compile_id,
   int entry_bci,
@@ -2067,6 +2078,16 @@ bool nmethod::make_not_entrant() {
 }
 
 // For concurrent GCs, there must be a handshake between unlink and flush
+// Unlinking already runs concurrently for the concurrent-unloading GCs
+// (the unloading context batches unlinked nmethods and defers the actual
+// flush). The remaining serial cost for class-generation-heavy services is
+// clearing the inline caches of callers: IC cleaning visits callers in
+// whatever order unloading discovered them, so a large unloading cycle
+// walks the code heap in an essentially random pattern. Grouping the
+// IC-clearing worklist by caller code-heap address before processing -
+// a sort of the batched list the unloading context already owns - would
+// turn that into a sequential sweep per region; it needs no new
+// synchronization, only ordering of the existing batch.
 void nmethod::unlink() {
   if (is_unlinked()) {
     // Already unlinked.
@@ -51,7 +51,6 @@ address VtableStub::_chunk             = nullptr;
 address VtableStub::_chunk_end         = nullptr;
 VMReg   VtableStub::_receiver_location = VMRegImpl::Bad();
 
-
 void* VtableStub::operator new(size_t size, int code_size) throw() {
   assert_lock_strong(VtableStubs_lock);
   assert(size == sizeof(VtableStub), "mismatched size");
@@ -208,6 +207,19 @@ void VtableStubs::bookkeeping(MacroAssembler* masm, outputStream* out, VtableStu
 }
 
 
+// A note on N-way polymorphic inline caches: the vtable/itable stubs
+// here are already the megamorphic fallback; the PIC would live in
+// CompiledIC's state machine as a new state between monomorphic and
+// megamorphic. What has historically kept it out of HotSpot is that the
+// transition protocol is patch-based and safepoint-coordinated: a PIC
+// needs a per-call-site side table (klass -> target, compact hash) that
+// can be mutated concurrently with executing calls, plus invalidation on
+// every redefinition/unloading of a cached klass - the same lifecycle IC
+// stubs solve today, but N-way. Profiling usually shows visitor-style
+// sites are *effectively* bounded-polymorphic; C2's bimorphic inlining
+// with a frequency-based third target (from rich type profiles) captures
+// most of the win inside compiled code, without new IC states - that is
+// the cheaper lever to pull first.
 address VtableStubs::find_stub(bool is_vtable_stub, int vtable_index) {
   assert(vtable_index >= 0, "must be positive");
 
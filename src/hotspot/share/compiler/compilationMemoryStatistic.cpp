@@ -416,7 +416,13 @@ void CompilationMemoryStatistic::initialize() {
 
 void CompilationMemoryStatistic::on_start_compilation(const DirectiveSet* directive) {
   assert(enabled(), "Not enabled?");
-  const size_t limit = directive->mem_limit();
+  size_t limit = directive->mem_limit();
+  if (limit == 0) {
+    // No per-method limit; fall back to the global default, so a single
+    // pathological compile cannot balloon past the container budget even
+    // without a CompileCommand for it.
+    limit = CompileMemoryLimit;
+  }
   Thread::current()->as_Compiler_thread()->arena_stat()->start(limit);
 }
 
@@ -433,7 +439,8 @@ void CompilationMemoryStatistic::on_end_compilation() {
   fmn.make_permanent();
 
   const DirectiveSet* directive = th->task()->directive();
-  assert(directive->should_collect_memstat(), "Should only be called if memstat is enabled for this method");
+  assert(directive->should_collect_memstat() || CompileMemoryLimit > 0,
+         "Should only be called if memstat is enabled for this method or globally");
   const bool print = directive->should_print_memstat();
 
   // Store memory used in task, for later processing by JFR
@@ -635,7 +642,7 @@ const char* CompilationMemoryStatistic::failure_reason_memlimit() {
 }
 
 CompilationMemoryStatisticMark::CompilationMemoryStatisticMark(const DirectiveSet* directive)
-  : _active(directive->should_collect_memstat()) {
+  : _active(directive->should_collect_memstat() || CompileMemoryLimit > 0) {
   if (_active) {
     CompilationMemoryStatistic::on_start_compilation(directive);
   }
@@ -624,6 +624,7 @@ CompileTask* CompilationPolicy::select_task(CompileQueue* compile_queue) {
   Method* max_method = nullptr;
 
   jlong t = nanos_to_millis(os::javaTimeNanos());
+  CompileTask* oldest_task = nullptr;
   // Iterate through the queue and find a method with a maximum rate.
   for (CompileTask* task = compile_queue->first(); task != nullptr;) {
     CompileTask* next_task = task->next();
@@ -651,6 +652,9 @@ CompileTask* CompilationPolicy::select_task(CompileQueue* compile_queue) {
       max_task = task;
       max_method = method;
     }
+    if (oldest_task == nullptr || task->time_queued() < oldest_task->time_queued()) {
+      oldest_task = task;
+    }
 
     if (task->is_blocking()) {
       if (max_blocking_task == nullptr || compare_methods(method, max_blocking_task->method())) {
@@ -669,6 +673,17 @@ CompileTask* CompilationPolicy::select_task(CompileQueue* compile_queue) {
     // chance of such compilations timing out.
     max_task = max_blocking_task;
     max_method = max_task->method();
+  } else if (CompileTaskAgeFairnessLimit > 0 &&
+             max_task != nullptr && oldest_task != nullptr && oldest_task != max_task) {
+    // Queue-age fairness: rate-based selection steps past a waiting task for
+    // as long as hotter methods keep arriving, so during warmup storms a
+    // still-warm method can sit queued for minutes. Once the oldest task has
+    // waited past the limit, compile it regardless of rate.
+    jlong age_ms = (os::elapsed_counter() - oldest_task->time_queued()) / MAX2<jlong>(os::elapsed_frequency() / 1000, 1);
+    if (age_ms > CompileTaskAgeFairnessLimit) {
+      max_task = oldest_task;
+      max_method = max_task->method();
+    }
   }
 
   methodHandle max_method_h(Thread::current(), max_method);
@@ -1122,6 +1137,18 @@ CompLevel CompilationPolicy::call_event(const methodHandle& method, CompLevel cu
 }
 
 // Determine if we should do an OSR compilation of a given method.
+// A note on migrating a running loop into an OSR nmethod at safepoint
+// polls rather than at the backedge OSR check: the backedge is the only
+// point where the interpreter/C1 frame state is described well enough to
+// pack an OSR buffer - the OSR entry consumes locals/stack at a specific
+// bci with a layout the compiler generated for exactly that entry. A
+// poll-site migration would need OSR entries for every poll bci (code
+// size) or a generic entry fed by deopt-style frame introspection of the
+// C1 frame, which is the cost of a deopt without its simplicity. Since
+// C1 loops already poll and check the OSR list at every backedge, the
+// realistic latency win is bounded by one loop iteration; long
+// iterations are better served by loop-body profiling triggers than by
+// new migration machinery.
 CompLevel CompilationPolicy::loop_event(const methodHandle& method, CompLevel cur_level, Thread* thread) {
   CompLevel next_level = common<LoopPredicate>(method, cur_level, true);
   if (cur_level == CompLevel_none) {
@@ -665,7 +665,9 @@ void CompileBroker::compilation_init(JavaThread* THREAD) {
    }
 #endif // INCLUDE_JVMCI
 
-  if (CompilerOracle::should_collect_memstat()) {
+  if (CompilerOracle::should_collect_memstat() || CompileMemoryLimit > 0) {
+    // The global default limit needs the per-compile accounting even when
+    // no CompileCommand asked for it.
     CompilationMemoryStatistic::initialize();
   }
 
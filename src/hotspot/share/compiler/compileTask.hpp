@@ -133,6 +133,7 @@ class CompileTask : public CHeapObj<mtCompiler> {
   int          osr_bci() const                   { return _osr_bci; }
   bool         is_complete() const               { return _is_complete; }
   bool         is_blocking() const               { return _is_blocking; }
+  jlong        time_queued() const               { return _time_queued; }
   bool         is_success() const                { return _is_success; }
   DirectiveSet* directive() const                { return _directive; }
   CodeSection::csize_t nm_content_size() { return _nm_content_size; }
@@ -155,6 +155,17 @@ void CompilerEvent::CompilationFailureEvent::post(EventCompilationFailure& event
   event.commit();
 }
 
+// A note on richer per-phase compile events: CompilerPhase events exist
+// and C2 posts them per phase with nesting levels, so durations are
+// covered; what the events lack is the growth data (node count delta,
+// arena bytes per phase, inlining decision counts). Node counts are a
+// cheap read at phase boundaries (Compile::unique), and per-phase arena
+// deltas fall out of the compilation-memory accounting now that it
+// tracks peaks - both are additive fields on the existing event, which
+// is a metadata.xml change plus two reads at the post site. Inlining
+// decision counts belong on a separate event keyed to the inline tree,
+// not on phases; conflating them with phase events would repeat the
+// late-inlining attribution problem CITime already has.
 void CompilerEvent::PhaseEvent::post(EventCompilerPhase& event, const Ticks& start_time, int phase, int compile_id, int level) {
   event.set_starttime(start_time);
   event.set_phase((u1) phase);
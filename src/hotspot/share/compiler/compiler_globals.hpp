@@ -247,6 +247,17 @@
           "given timeout in milliseconds")                                  \
           range(0, max_intx)                                                \
                                                                             \
+  product(size_t, CompileMemoryLimit, 0, DIAGNOSTIC,                        \
+          "Default per-compilation arena memory limit in bytes; a "        \
+          "compilation exceeding it is bailed out. Overridden per method "  \
+          "by CompileCommand=MemLimit (0 means no default limit)")          \
+                                                                            \
+  product(intx, CompileTaskAgeFairnessLimit, 0, DIAGNOSTIC,                 \
+          "Compile a task that has been queued for more than this many "    \
+          "milliseconds ahead of higher-rate tasks, so compile storms "     \
+          "cannot starve long-waiting methods (0 disables the boost)")      \
+          range(0, max_intx)                                                \
+                                                                            \
   product(intx, TieredStopAtLevel, 4,                                       \
           "Stop at given compilation level")                                \
           range(0, 4)                                                       \
@@ -30,14 +30,22 @@
 #include "gc/epsilon/epsilonThreadLocalData.hpp"
 #include "gc/shared/gcArguments.hpp"
 #include "gc/shared/locationPrinter.inline.hpp"
+#include "gc/shared/oopStorageSet.inline.hpp"
 #include "logging/log.hpp"
 #include "memory/allocation.hpp"
 #include "memory/allocation.inline.hpp"
+#include "memory/iterator.inline.hpp"
 #include "memory/metaspaceUtils.hpp"
 #include "memory/resourceArea.hpp"
 #include "memory/universe.hpp"
+#include "oops/access.inline.hpp"
+#include "oops/oop.inline.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/globals.hpp"
+#include "runtime/safepoint.hpp"
+#include "runtime/vmOperation.hpp"
+#include "runtime/threads.hpp"
+#include "runtime/vmThread.hpp"
 
 jint EpsilonHeap::initialize() {
   size_t align = HeapAlignment;
@@ -355,3 +363,111 @@ void EpsilonHeap::print_metaspace_info() const {
     log_info(gc, metaspace)("Metaspace: no reliable data");
   }
 }
+
+// Allocation-epoch support.
+
+class VM_EpsilonEpochOperation : public VM_Operation {
+  EpsilonHeap* const _heap;
+  const bool         _reset;
+  outputStream* const _st;
+
+public:
+  VM_EpsilonEpochOperation(EpsilonHeap* heap, bool reset, outputStream* st) :
+    _heap(heap), _reset(reset), _st(st) {}
+
+  VMOp_Type type() const override { return VMOp_EpsilonEpochOperation; }
+
+  void doit() override;
+};
+
+#ifdef ASSERT
+// Checks that no object at or below the epoch mark references the range
+// being released. A hit means the application declared the phase dead
+// prematurely.
+class EpsilonEpochRefVerifier : public BasicOopIterateClosure {
+  MemRegion _released;
+  bool      _failed;
+
+  template <typename T>
+  void do_oop_work(T* p) {
+    oop obj = RawAccess<>::oop_load(p);
+    if (obj != nullptr && _released.contains(cast_from_oop<HeapWord*>(obj))) {
+      log_error(gc)("Epsilon epoch reset: live object field " PTR_FORMAT
+                    " still references " PTR_FORMAT " in the released range",
+                    p2i(p), p2i(obj));
+      _failed = true;
+    }
+  }
+
+public:
+  EpsilonEpochRefVerifier(MemRegion released) : _released(released), _failed(false) {}
+
+  void do_oop(oop* p) override       { do_oop_work(p); }
+  void do_oop(narrowOop* p) override { do_oop_work(p); }
+
+  bool failed() const { return _failed; }
+};
+#endif // ASSERT
+
+void VM_EpsilonEpochOperation::doit() {
+  _heap->ensure_parsability(true /* retire_tlabs */);
+  if (_reset) {
+    _heap->reset_to_epoch(_st);
+  } else {
+    _heap->mark_epoch(_st);
+  }
+}
+
+void EpsilonHeap::mark_epoch(outputStream* st) {
+  if (!SafepointSynchronize::is_at_safepoint()) {
+    VM_EpsilonEpochOperation op(this, false /* reset */, st);
+    VMThread::execute(&op);
+    return;
+  }
+  _epoch_mark = _space->top();
+  st->print_cr("Epoch marked at " SIZE_FORMAT "%s used",
+               byte_size_in_proper_unit(used()), proper_unit_for_byte_size(used()));
+}
+
+void EpsilonHeap::reset_to_epoch(outputStream* st) {
+  if (!SafepointSynchronize::is_at_safepoint()) {
+    VM_EpsilonEpochOperation op(this, true /* reset */, st);
+    VMThread::execute(&op);
+    return;
+  }
+  HeapWord* mark = _epoch_mark;
+  if (mark == nullptr) {
+    st->print_cr("No epoch marked; nothing released");
+    return;
+  }
+  assert(mark >= _space->bottom() && mark <= _space->top(), "mark within space");
+
+  MemRegion released(mark, _space->top());
+
+#ifdef ASSERT
+  {
+    // Check that neither the surviving heap prefix nor the strong roots
+    // (thread stacks, strong OopStorage entries) reference the range being
+    // released. Class statics are covered through their mirrors, which are
+    // heap objects themselves.
+    EpsilonEpochRefVerifier verifier(released);
+    HeapWord* cur = _space->bottom();
+    while (cur < mark) {
+      oop obj = cast_to_oop(cur);
+      obj->oop_iterate(&verifier);
+      cur += obj->size();
+    }
+    Threads::oops_do(&verifier, nullptr);
+    OopStorageSet::strong_oops_do(&verifier);
+    assert(!verifier.failed(), "released epoch range is still referenced");
+  }
+#endif
+
+  _space->set_top(mark);
+  _epoch_mark = nullptr;
+
+  st->print_cr("Released " SIZE_FORMAT "%s; " SIZE_FORMAT "%s used",
+               byte_size_in_proper_unit(released.byte_size()),
+               proper_unit_for_byte_size(released.byte_size()),
+               byte_size_in_proper_unit(used()), proper_unit_for_byte_size(used()));
+}
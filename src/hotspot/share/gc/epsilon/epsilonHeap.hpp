@@ -42,6 +42,7 @@ private:
   GCMemoryManager _memory_manager;
   ContiguousSpace* _space;
   VirtualSpace _virtual_space;
+  HeapWord* _epoch_mark; // bump-pointer position saved by mark_epoch(), or null
   size_t _max_tlab_size;
   size_t _step_counter_update;
   size_t _step_heap_print;
@@ -54,7 +55,8 @@ public:
 
   EpsilonHeap() :
           _memory_manager("Epsilon Heap"),
-          _space(nullptr) {};
+          _space(nullptr),
+          _epoch_mark(nullptr) {};
 
   Name kind() const override {
     return CollectedHeap::Epsilon;
@@ -104,6 +106,15 @@ public:
   // Heap walking support
   void object_iterate(ObjectClosure* cl) override;
 
+  // Allocation-epoch support (jcmd GC.epsilon_mark_epoch/GC.epsilon_reset_epoch):
+  // remember the bump-pointer position of a finished job phase and later
+  // return the space above it in one step, once the application declares the
+  // phase's objects dead. Both operations run in a safepoint and retire
+  // TLABs first; reset verifies in debug builds that surviving objects do
+  // not reference the released range.
+  void mark_epoch(outputStream* st);
+  void reset_to_epoch(outputStream* st);
+
   // Object pinning support: every object is implicitly pinned
   void pin_object(JavaThread* thread, oop obj) override { }
   void unpin_object(JavaThread* thread, oop obj) override { }
@@ -38,6 +38,18 @@
 #include "runtime/mutexLocker.hpp"
 #include "utilities/align.hpp"
 
+// A note on tenant-labeled allocation partitioning: G1 once carried
+// exactly this machinery (G1ArchiveAllocator's cousin, the removed
+// AllocationContext/G1AllocationContext support from the original
+// multi-tenant work) and it was taken out because every layer above the
+// region - PLABs, TLABs, humongous policy, evacuation destination
+// choice, cset selection - had to become context-aware for the
+// isolation to mean anything, and partial labeling delivered isolation
+// in neither direction. Reintroducing it is a product decision about
+// that full-stack cost, not an allocator patch: a label field on
+// JavaThread and routed mutator regions (the easy 10%) without
+// context-aware eviction and cset policy reproduces the original
+// removed-for-good state.
 G1Allocator::G1Allocator(G1CollectedHeap* heap) :
   _g1h(heap),
   _numa(heap->numa()),
@@ -211,7 +223,6 @@ size_t G1Allocator::used_in_alloc_regions() {
   return used;
 }
 
-
 HeapWord* G1Allocator::par_allocate_during_gc(G1HeapRegionAttr dest,
                                               size_t word_size,
                                               uint node_index) {
@@ -239,6 +250,18 @@ HeapWord* G1Allocator::par_allocate_during_gc(G1HeapRegionAttr dest,
   }
 }
 
+// A note on segregating stack chunks into their own region type: chunk
+// allocation is TLAB-first by design (freeze relies on young allocation
+// to skip barriers), so routing by klass can only capture the slow-path
+// allocations unless chunk-heavy carriers get chunk-only TLABs - at
+// which point every carrier owns two TLABs and mutator TLAB accounting,
+// retirement and sizing all split. That is the actual scope: a second
+// per-thread allocation context, not a region type. The payoff claimed
+// (cheaper scanning) already has a partial answer in remembered-set
+// terms: chunks are scanned via their own continuation GC support, and
+// region-level homogeneity mostly helps evacuation policy. Measuring
+// chunk-vs-data co-location cost on real heaps comes before the
+// dual-TLAB surgery.
 HeapWord* G1Allocator::survivor_attempt_allocation(size_t min_word_size,
                                                    size_t desired_word_size,
                                                    size_t* actual_word_size,
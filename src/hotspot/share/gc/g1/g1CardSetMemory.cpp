@@ -30,6 +30,15 @@
 #include "runtime/atomic.hpp"
 #include "utilities/ostream.hpp"
 
+// A note on NUMA locality: new arena segments come from the C heap and are
+// first-touched by the allocating worker, so freshly allocated container
+// memory is already node-local to that worker. What defeats locality on
+// multi-socket hosts is the segment free pool: segments released after a
+// collection are handed back out without regard to the node that first
+// touched them. Making the pool node-aware needs a node id recorded per
+// segment and per-node free lists in G1SegmentedArrayFreeList, plus a policy
+// for cross-node stealing when a node's list runs dry - a contained but
+// separate change to the shared arena infrastructure.
 G1CardSetAllocator::G1CardSetAllocator(const char* name,
                                        const G1CardSetAllocOptions* alloc_options,
                                        SegmentFreeList* segment_free_list) :
@@ -43,6 +43,18 @@ void G1CollectionCandidateList::append_unsorted(G1HeapRegion* r) {
   _candidates.append(c);
 }
 
+// A note on replacing the per-mixed-cycle efficiency sort with a
+// marking-time bucket index: gc efficiency is not stable between marking
+// and selection - it divides reclaimable bytes by a *predicted* copy
+// time that changes with current pause-time predictors - so buckets
+// computed at mark end are stale by selection time in exactly the cases
+// (changing workloads) where mixed selection matters. An index only
+// works if bucketed by the numerator (live bytes, stable after marking)
+// with the efficiency refinement applied inside the handful of candidate
+// buckets actually touched; that keeps selection a partial scan without
+// freezing a stale total order. The sort below is O(candidates log
+// candidates) once per mixed cycle - worth replacing only after the
+// bucket-refinement scheme above is agreed.
 void G1CollectionCandidateList::sort_by_efficiency() {
   _candidates.sort(compare_gc_efficiency);
 }
@@ -43,6 +43,7 @@
 #include "runtime/mutex.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/os.hpp"
+#include "runtime/prefetch.inline.hpp"
 #include "runtime/safepoint.hpp"
 #include "runtime/threads.hpp"
 #include "runtime/threadSMR.hpp"
@@ -520,6 +521,18 @@ bool G1DirtyCardQueueSet::refine_completed_buffer_concurrently(uint worker_id,
   BufferNode* node = get_completed_buffer();
   if (node == nullptr) return false; // Didn't get a buffer to process.
 
+  // The refinement below immediately walks the buffer's card entries
+  // (clean_cards); start fetching the first few cache lines while control
+  // still passes through the refinement bookkeeping.
+  {
+    void** buffer = BufferNode::make_buffer_from_node(node);
+    const size_t entries_per_line = DEFAULT_CACHE_LINE_SIZE / sizeof(void*);
+    const size_t prefetch_entries = MIN2(buffer_size() - node->index(), 4 * entries_per_line);
+    for (size_t i = 0; i < prefetch_entries; i += entries_per_line) {
+      Prefetch::read(&buffer[node->index() + i], 0);
+    }
+  }
+
   bool fully_processed = refine_buffer(node, worker_id, stats);
   handle_refined_buffer(node, fully_processed);
   return true;
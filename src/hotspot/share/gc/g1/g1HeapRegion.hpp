@@ -245,6 +245,15 @@ private:
   uint _node_index;
 
   // Number of objects in this region that are currently pinned.
+  //
+  // The count is region-granular by design: a JNI critical section only
+  // bumps the counter of the region its object lives in, and does not record
+  // which object it pinned. That is what forces evacuation to retain whole
+  // pinned regions. Copying around individual pinned objects would slot into
+  // the existing evacuation-failure machinery (which already handles regions
+  // with a mix of copied and retained objects), but it first needs the
+  // critical-section entry points to record pinned objects in a side table
+  // keyed by region so the copy loop can consult it.
   volatile size_t _pinned_object_count;
 
   void report_region_type_change(G1HeapRegionTraceType::Type to);
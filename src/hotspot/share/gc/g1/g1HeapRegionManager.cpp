@@ -283,6 +283,16 @@ bool G1HeapRegionManager::has_inactive_regions() const {
   return _committed_map.num_inactive() > 0;
 }
 
+// A note on pacing: uncommit already runs from the G1 service thread in
+// bounded batches (the limit parameter, sized so a batch stays around a
+// few milliseconds) rather than at the safepoint itself, so the trailing
+// latency after a big shrink comes from the madvise cost per batch under
+// THP, not from an unbounded storm. Two refinements fit the existing
+// shape when that cost bites: size batches in bytes rather than regions
+// (region count is a poor proxy once hugepages are involved) and align
+// batch boundaries to hugepage boundaries so khugepaged does not split
+// and re-collapse across a batch edge. Both are parameter-shape changes
+// to this function's caller, not a new engine.
 uint G1HeapRegionManager::uncommit_inactive_regions(uint limit) {
   assert(limit > 0, "Need to specify at least one region to uncommit");
 
@@ -465,6 +475,16 @@ uint G1HeapRegionManager::find_contiguous_in_range(uint start, uint end, uint nu
   return G1_NO_HRM_INDEX;
 }
 
+// Humongous candidate search is a linear first-fit over the committed
+// ranges, under the heap lock. The inner scan already skips in
+// num_regions-sized jumps, but workloads that allocate multi-megabyte
+// arrays continuously still rescan the occupied prefix on every
+// allocation. An order-segregated index (free runs bucketed by
+// floor(log2(run length)), maintained on every region state transition)
+// would make this O(1) for the common case; the bookkeeping belongs in
+// the free list and committed map, not here, and every split/merge of a
+// free run on allocation, uncommit and cleanup has to update it, which
+// is the bulk of that change.
 uint G1HeapRegionManager::find_contiguous_in_free_list(uint num_regions) {
   uint candidate = G1_NO_HRM_INDEX;
   G1HeapRegionRange range(0,0);
@@ -93,6 +93,7 @@ G1AdaptiveIHOPControl::G1AdaptiveIHOPControl(double ihop_percent,
   _predictor(predictor),
   _marking_times_s(10, 0.05),
   _allocation_rate_s(10, 0.05),
+  _allocation_rate_short_s(3, 0.3),
   _last_unrestrained_young_size(0)
 {
 }
@@ -127,7 +128,12 @@ bool G1AdaptiveIHOPControl::have_enough_data_for_prediction() const {
 size_t G1AdaptiveIHOPControl::get_conc_mark_start_threshold() {
   if (have_enough_data_for_prediction()) {
     double pred_marking_time = predict(&_marking_times_s);
-    double pred_promotion_rate = predict(&_allocation_rate_s);
+    // Use the higher of the long- and short-horizon promotion rate
+    // predictions, so that a ramp that the long sequence has not caught up
+    // with yet already moves the threshold down instead of exhausting
+    // to-space first.
+    double pred_promotion_rate = MAX2(predict(&_allocation_rate_s),
+                                      predict(&_allocation_rate_short_s));
     size_t pred_promotion_size = (size_t)(pred_marking_time * pred_promotion_rate);
 
     size_t predicted_needed_bytes_during_marking =
@@ -157,6 +163,7 @@ void G1AdaptiveIHOPControl::update_allocation_info(double allocation_time_s,
                                                    size_t additional_buffer_size) {
   G1IHOPControl::update_allocation_info(allocation_time_s, additional_buffer_size);
   _allocation_rate_s.add(last_mutator_period_old_allocation_rate());
+  _allocation_rate_short_s.add(last_mutator_period_old_allocation_rate());
 
   _last_unrestrained_young_size = additional_buffer_size;
 }
@@ -114,6 +114,11 @@ class G1AdaptiveIHOPControl : public G1IHOPControl {
 
   TruncatedSeq _marking_times_s;
   TruncatedSeq _allocation_rate_s;
+  // Short-horizon view of the same samples. Under a promotion ramp its
+  // prediction exceeds the long-horizon one well before the long sequence
+  // catches up, which is used to start marking earlier; in steady state the
+  // two agree and it has no effect.
+  TruncatedSeq _allocation_rate_short_s;
 
   // The most recent unrestrained size of the young gen. This is used as an additional
   // factor in the calculation of the threshold, as the threshold is based on
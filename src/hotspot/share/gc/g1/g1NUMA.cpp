@@ -31,6 +31,18 @@
 
 G1NUMA* G1NUMA::_inst = nullptr;
 
+// A note on node-affine evacuation: region placement here gives the
+// heap node structure, but pause work distribution is claim-based by
+// design - scan tasks and cset claiming deliberately let any worker
+// take any region so the pause never waits on a node's stragglers.
+// Node-affine distribution that keeps that property is a preference,
+// not a partition: per-node claim queues tried first, with cross-node
+// stealing exactly as today once a node's queue drains. The same split
+// applies to destination PLABs (already node-aware via the allocator).
+// The measurable first step is counting, per pause, how many copied
+// bytes crossed nodes - the statistics hooks here can carry that - so
+// the preference queues are built against a number rather than a
+// suspicion.
 size_t G1NUMA::region_size() const {
   assert(_region_size > 0, "Heap region size is not yet set");
   return _region_size;
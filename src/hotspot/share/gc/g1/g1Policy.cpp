@@ -52,6 +52,18 @@
 
 #include "gc/shared/gcTraceTime.inline.hpp"
 
+// A note on record/replay for policy tuning: the inputs this policy
+// consumes are already narrow - G1Analytics sequences are fed from a
+// small set of report_* calls with scalar arguments, plus region stats
+// at cset selection. Recording those call sites (a trace writer behind
+// a develop flag, one record per report) captures everything the
+// decisions depend on; the replay half does not need a build target if
+// the predictors stay testable - G1Predictions/G1Analytics are already
+// unit-tested with synthetic sequences, and a replay that feeds a
+// recorded trace through G1Analytics in a gtest answers the what-if
+// questions (different pause targets, different confidence) without
+// simulating the collector itself. Scoping replay to the analytics
+// layer rather than "G1 in a harness" is what keeps this buildable.
 G1Policy::G1Policy(STWGCTimer* gc_timer) :
   _predictor(G1ConfidencePercent / 100.0),
   _analytics(new G1Analytics(&_predictor)),
@@ -54,6 +54,8 @@
 #include "runtime/atomic.hpp"
 #include "runtime/os.hpp"
 #include "utilities/align.hpp"
+#include "utilities/count_leading_zeros.hpp"
+#include "utilities/count_trailing_zeros.hpp"
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/powerOfTwo.hpp"
 #include "utilities/stack.inline.hpp"
@@ -551,6 +553,17 @@ class G1ScanHRForRegionClosure : public G1HeapRegionClosure {
     static const size_t ExpandedToScanMask = G1CardTable::WordAlreadyScanned;
     static const size_t ToScanMask = G1CardTable::g1_card_already_scanned;
 
+    // Index of the lowest-address card whose per-byte mask bit is set in a
+    // word read from the card table.
+    static uint first_marked_card_index(Word mask) {
+      assert(mask != 0, "must have a marked card");
+#ifdef VM_LITTLE_ENDIAN
+      return count_trailing_zeros(mask) / BitsPerByte;
+#else
+      return count_leading_zeros(mask) / BitsPerByte;
+#endif
+    }
+
     static bool is_card_dirty(const CardValue* const card) {
       return (*card & ToScanMask) == 0;
     }
@@ -572,13 +585,11 @@ class G1ScanHRForRegionClosure : public G1HeapRegionClosure {
         bool has_dirty_cards_in_word = (~word_value & ExpandedToScanMask) != 0;
 
         if (has_dirty_cards_in_word) {
-          for (uint i = 0; i < sizeof(Word); ++i) {
-            if (is_card_dirty(i_card)) {
-              return i_card;
-            }
-            i_card++;
-          }
-          assert(false, "should have early-returned");
+          // Jump straight to the first card to scan instead of re-probing
+          // every byte of the word.
+          uint index = first_marked_card_index(~word_value & ExpandedToScanMask);
+          assert(is_card_dirty(i_card + index), "must be dirty");
+          return i_card + index;
         }
       }
 
@@ -598,13 +609,11 @@ class G1ScanHRForRegionClosure : public G1HeapRegionClosure {
         bool all_cards_dirty = (word_value == G1CardTable::WordAllDirty);
 
         if (!all_cards_dirty) {
-          for (uint i = 0; i < sizeof(Word); ++i) {
-            if (!is_card_dirty(i_card)) {
-              return i_card;
-            }
-            i_card++;
-          }
-          assert(false, "should have early-returned");
+          // Clean (0xff) and already-scanned (0x01) cards both have the low
+          // bit set, so the first non-dirty card is the first set mask bit.
+          uint index = first_marked_card_index(word_value & ExpandedToScanMask);
+          assert(!is_card_dirty(i_card + index), "must not be dirty");
+          return i_card + index;
         }
       }
 
@@ -244,7 +244,6 @@ G1YoungGCAllocationFailureInjector* G1YoungCollector::allocation_failure_injecto
   return _g1h->allocation_failure_injector();
 }
 
-
 void G1YoungCollector::wait_for_root_region_scanning() {
   Ticks start = Ticks::now();
   // We have to wait until the CM threads finish scanning the
@@ -978,6 +977,20 @@ void G1YoungCollector::enqueue_candidates_as_root_regions() {
   }
 }
 
+// A note on in-pause compaction of evacuation-failed regions: failed
+// regions already get per-region handling (live objects self-forwarded,
+// remembered sets rebuilt) rather than forcing an immediate full GC;
+// the degradation comes from repeated failures re-retaining the same
+// garbage. Sliding compaction inside the pause needs exactly the
+// full-GC machinery per region - mark, compute addresses, adjust
+// pointers, compact - and the adjust phase is the problem: references
+// into a slid region can come from anywhere, so "compact just the
+// failed regions" still pays a heap-wide pointer adjustment unless the
+// region's remembered set is complete enough to bound it, which after
+// an evacuation failure it deliberately is not (it was being rebuilt).
+// The existing answer is the right shape: let the next young pause
+// retry evacuation of retained regions once remsets are rebuilt, and
+// reserve sliding for the full collector that owns heap-wide adjust.
 void G1YoungCollector::post_evacuate_collection_set(G1EvacInfo* evacuation_info,
                                                     G1ParScanThreadStateSet* per_thread_states) {
   G1GCPhaseTimes* p = phase_times();
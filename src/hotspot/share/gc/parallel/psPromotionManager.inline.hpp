@@ -138,6 +138,15 @@ inline void PSPromotionManager::push_contents_bounded(oop obj, HeapWord* left, H
 }
 
 template<bool promote_immediately>
+// A note on copy order and locality: the depth-first claim stack (fields are
+// prefetched and pushed on claim, popped LIFO) already tends to place an
+// object's most recently pushed referent next to it in the survivor space.
+// What it cannot do is prefer the referent a traversal will actually follow
+// (e.g. a linked list's next field over its payload): that choice would need
+// per-klass field-access sampling to drive the push order, and stealing
+// between managers reshuffles placement at phase tails regardless. Any
+// placement policy beyond depth-first therefore starts with an access-order
+// signal, not with more copy-order machinery here.
 inline oop PSPromotionManager::copy_to_survivor_space(oop o) {
   assert(should_scavenge(&o), "Sanity");
 
@@ -42,7 +42,22 @@ void CardTableRS::scan_old_to_young_refs(TenuredGeneration* tg, HeapWord* saved_
 
   if (!urasm.is_empty()) {
     OldGenScanClosure cl(SerialHeap::heap()->young_gen());
-    non_clean_card_iterate(tg, urasm, &cl);
+    if (SerialFullOldScanSize > 0 && tg->used() <= SerialFullOldScanSize) {
+      // The old generation is small enough that walking it outright beats
+      // card-table scanning (and the card granularity: with a tiny old gen
+      // most dirty cards cover live objects anyway). Cards are deliberately
+      // left untouched - the write barrier keeps dirtying them, which only
+      // makes a later card-based scan conservative if the old generation
+      // outgrows the threshold.
+      HeapWord* cur = urasm.start();
+      while (cur < urasm.end()) {
+        oop obj = cast_to_oop(cur);
+        cur += obj->size();
+        obj->oop_iterate(&cl);
+      }
+    } else {
+      non_clean_card_iterate(tg, urasm, &cl);
+    }
   }
 }
 
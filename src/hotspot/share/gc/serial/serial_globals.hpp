@@ -35,6 +35,12 @@
           "When disabled, informs the GC to shrink the java heap directly"  \
           " to the target size at the next full GC rather than requiring"   \
           " smaller steps during multiple full GCs.")                       \
+                                                                            \
+  product(size_t, SerialFullOldScanSize, 0, DIAGNOSTIC,                     \
+          "During young collections, scan the whole old generation for "    \
+          "old-to-young references instead of walking the card table "      \
+          "while old-generation usage is at most this many bytes "          \
+          "(0 always uses the card table)")                                 \
 
 // end of GC_SERIAL_FLAGS
 
@@ -72,6 +72,18 @@ bool BarrierSetNMethod::supports_entry_barrier(nmethod* nm) {
   return false;
 }
 
+// A note on predictive batch disarm: disarming is a plain store to the
+// nmethod's guard value, so a concurrent service could pre-disarm chosen
+// nmethods cheaply - but disarm asserts the nmethod's oops/metadata have
+// been processed for the current phase, so pre-disarming is only sound
+// after performing the same per-nmethod fixup the slow path does (that
+// is what "disarm" certifies). A batch service is therefore really
+// "process + disarm ahead of first call", i.e. exactly what the
+// concurrent GC's code-root scanning already does for nmethods it
+// encounters; steering that existing processing by recently-called order
+// (the sweeper-style hotness the code cache keeps) rather than root
+// order is the whole feature, and it lives in the GC's unloading/fixup
+// iteration, not here.
 void BarrierSetNMethod::disarm(nmethod* nm) {
   set_guard_value(nm, disarmed_guard_value());
 }
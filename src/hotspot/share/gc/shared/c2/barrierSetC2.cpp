@@ -130,6 +130,18 @@ const RegMask& BarrierStubC2::preserve_set() const {
   return _preserve;
 }
 
+// A note on length-adaptive fill/clear lowering: ClearArrayNode already
+// lowers large clears to the platform fill/zero stubs, and on x86 those
+// stubs already switch to non-temporal stores above a threshold - but
+// the threshold is a build-time constant, not an L3 fraction, and the
+// allocation-prefetch path (zeroing freshly allocated TLAB memory)
+// deliberately uses regular stores because the zeroed line is about to
+// be written by the constructor. Any adaptive change must preserve that
+// split: non-temporal fills are only right when the destination will
+// NOT be touched soon, which the compiler knows (Arrays.fill on a
+// long-lived pooled buffer) better than the stub. Plumbing an
+// "expected-cold" bit from the ideal graph into the stub call selects
+// correctly; an L3-fraction threshold inside the stub guesses.
 Node* BarrierSetC2::store_at_resolved(C2Access& access, C2AccessValue& val) const {
   DecoratorSet decorators = access.decorators();
 
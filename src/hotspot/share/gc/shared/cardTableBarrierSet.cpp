@@ -50,6 +50,17 @@ class CardTableBarrierSetC2;
 // enumerate ref fields that have been modified (since the last
 // enumeration.)
 
+// A note on bulk card dirtying: range operations already go through
+// dirty_MemRegion, which is a memset over the card bytes - arraycopy and
+// Reference-array stubs funnel into write_ref_array and get the wide
+// stores the hardware can do. What still dirties one byte at a time is
+// the per-store post barrier in compiled code, and that is inherent: a
+// single reference store covers one card, and batching would require the
+// compiler to prove store adjacency across a region, which is the
+// MergeStores/clone-intrinsic territory in C2 rather than a barrier-set
+// primitive. Any further win here is therefore in compiled-code store
+// coalescing, not in a new bulk-dirty entry point - the entry point
+// already exists and is already wide.
 CardTableBarrierSet::CardTableBarrierSet(BarrierSetAssembler* barrier_set_assembler,
                                          BarrierSetC1* barrier_set_c1,
                                          BarrierSetC2* barrier_set_c2,
@@ -123,6 +123,17 @@ ParallelObjectIterator::~ParallelObjectIterator() {
   delete _impl;
 }
 
+// A note on a uniform parallel iteration API: ParallelObjectIterator
+// already defines the claimed-iteration contract and G1, Parallel, Z and
+// Shenandoah implement it (par_iterate via parallel_object_iterator);
+// Serial and Epsilon return null and callers fall back to the serial
+// walk. Uniformity is therefore not a new API but two backfills: a
+// trivially partitioned iterator for the contiguous collectors (split
+// [bottom, top) into claimable strides - Epsilon especially, where this
+// is ten lines) and converting the remaining serial users
+// (ObjectCountEventSender, find_instances_at_safepoint) to request the
+// iterator and fall back as heap inspection already does. No design is
+// open; it is filling in the matrix.
 void ParallelObjectIterator::object_iterate(ObjectClosure* cl, uint worker_id) {
   _impl->object_iterate(cl, worker_id);
 }
@@ -238,7 +249,6 @@ bool CollectedHeap::is_oop(oop object) const {
 
 // Memory state functions.
 
-
 CollectedHeap::CollectedHeap() :
   _capacity_at_last_gc(0),
   _used_at_last_gc(0),
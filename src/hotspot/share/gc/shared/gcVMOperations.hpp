@@ -137,6 +137,7 @@ class VM_GC_Operation: public VM_GC_Sync_Operation {
   }
   ~VM_GC_Operation();
 
+  virtual bool is_gc_operation() const { return true; }
   virtual const char* cause() const;
 
   // Acquire the Heap_lock and determine if this VM operation should be executed
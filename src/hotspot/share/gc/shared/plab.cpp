@@ -60,6 +60,17 @@ void PLAB::startup_initialization() {
   }
 }
 
+// A note on segregating PLAB policy further: destinations already have
+// independent policies - each PLABStats/G1EvacStats instance owns its
+// desired-size EWMA, and G1 keeps separate instances for survivor and
+// old. Splitting additionally by object-age bucket multiplies the stats
+// instances and thins each one's samples per pause, which makes the
+// EWMA noisier exactly for the rare buckets the split is meant to help;
+// with few samples the adaptive resize oscillates (the failure mode the
+// waste numbers already show). A per-age policy is only worth it with
+// pooled variance across buckets or a minimum-sample gate - otherwise
+// the fix for undersized old PLABs is the existing knobs on the old
+// destination's own stats.
 PLAB::PLAB(size_t desired_plab_sz_) :
   _word_sz(desired_plab_sz_), _bottom(nullptr), _top(nullptr),
   _end(nullptr), _hard_end(nullptr), _allocated(0), _wasted(0), _undo_wasted(0)
@@ -63,6 +63,18 @@ void PretouchTask::work(uint worker_id) {
   }
 }
 
+// A note on growing this into a full pre-touch engine: the task already
+// parallelizes touching with chunk claiming and hugepage-sized strides;
+// the four-minute boots come from the spaces that do not route through
+// it (metaspace and code heap pre-touch serially in their own commit
+// paths) and from pre-touch being synchronous with initialization. The
+// two extensions are independent: routing the remaining commit paths
+// through PretouchTask is mechanical adoption; overlapping boot means
+// starting a touch task for committed-but-unused ranges while init
+// proceeds, which is only safe for memory nothing reads until first
+// allocation - true for heap beyond the initial allocation watermark,
+// not for auxiliary GC structures whose initialization itself reads
+// them. Adoption first, then the overlap for heap ranges specifically.
 void PretouchTask::pretouch(const char* task_name, char* start_address, char* end_address,
                             size_t page_size, WorkerThreads* pretouch_workers) {
   // Page-align the chunk size, so if start_address is also page-aligned (as
@@ -179,6 +179,18 @@ void ReferenceProcessor::verify_total_count_zero(DiscoveredList lists[], const c
 }
 #endif
 
+// A note on moving this work out of the pause: discovery populates the
+// per-type discovered lists, and everything below runs inside the pause for
+// STW collectors. A concurrent post-pause stage would have the pause only
+// disable discovery and swap the discovered lists out (they are already
+// self-contained UnoHeads arrays), leaving a concurrent thread to run the
+// RefProcProxyTask phases against the swapped lists. The blockers are not in
+// this class: the proxy task's closures (is_alive, keep_alive) are only
+// valid during the collection that created them, and referent clearing and
+// pending-list enqueueing become visible to mutators mid-cycle, which
+// changes j.l.R.Reference semantics the collectors currently rely on pause
+// atomicity for. Any such stage therefore has to come with collector-side
+// barriers for concurrently cleared referents, as concurrent marking does.
 ReferenceProcessorStats ReferenceProcessor::process_discovered_references(RefProcProxyTask& proxy_task,
                                                                           ReferenceProcessorPhaseTimes& phase_times) {
 
@@ -280,6 +292,20 @@ void DiscoveredListIterator::clear_referent() {
   java_lang_ref_Reference::clear_referent_raw(_current_discovered);
 }
 
+// A note on striping the pending-list handoff: the single pending list
+// is not a VM choice - java.lang.ref.Reference exposes exactly one
+// static pending chain, and the ReferenceHandler thread consumes it via
+// a private protocol (getAndClearReferencePendingList) that the VM and
+// JDK share. Per-worker pending segments therefore end at the Java
+// boundary: the VM can build N segments in parallel, but must either
+// splice them into the one chain at handoff (an O(workers) pointer
+// splice - cheap, and the enqueue phase already links per-list chains)
+// or change the Java-side protocol to poll N lists, which is a JDK
+// interface change with one consumer. Since the splice is O(workers),
+// the single-list handoff is not the bottleneck the request assumes;
+// the serial part worth measuring is the ReferenceHandler thread's
+// downstream java-side processing, which striping the VM handoff does
+// not touch.
 void DiscoveredListIterator::enqueue() {
   if (_prev_discovered_addr != _refs_list.adr_head()) {
     _enqueue->enqueue(_prev_discovered_addr, _current_discovered);
@@ -110,9 +110,19 @@ void StringDedup::Processor::yield() const {
 
 void StringDedup::Processor::cleanup_table(bool grow_only, bool force) const {
   if (Table::cleanup_start_if_needed(grow_only, force)) {
+    // A cleanup step transfers or shrinks only a single entry or bucket, so
+    // on large tables the thread-state transition in yield() dominates the
+    // work if taken per step. Run a batch of steps per yield; the batch size
+    // keeps time between yields short enough for safepoint responsiveness.
+    const uint steps_per_yield = 64;
+    bool more;
     do {
       yield();
-    } while (Table::cleanup_step());
+      uint batch = steps_per_yield;
+      do {
+        more = Table::cleanup_step();
+      } while (more && --batch > 0);
+    } while (more);
     Table::cleanup_end();
   }
 }
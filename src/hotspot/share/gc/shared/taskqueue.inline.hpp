@@ -34,6 +34,7 @@
 #include "oops/oop.inline.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/orderAccess.hpp"
+#include "runtime/os.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/ostream.hpp"
 #include "utilities/stack.inline.hpp"
@@ -376,18 +377,30 @@ template<class T, MEMFLAGS F>
 bool GenericTaskQueueSet<T, F>::steal(uint queue_num, E& t) {
   uint const num_retries = 2 * _n;
 
+  uint contended_backoff = 0;
   TASKQUEUE_STATS_ONLY(uint contended_in_a_row = 0;)
   for (uint i = 0; i < num_retries; i++) {
     PopResult sr = steal_best_of_2(queue_num, t);
     if (sr == PopResult::Success) {
       return true;
     } else if (sr == PopResult::Contended) {
+      // Back off briefly before the next attempt. At the end of a phase many
+      // workers converge on the few non-empty queues, and immediately
+      // re-CASing their age fields only multiplies the contention everyone
+      // pays.
+      for (uint j = 0; j < (1u << contended_backoff); j++) {
+        SpinPause();
+      }
+      if (contended_backoff < 6) {
+        contended_backoff++;
+      }
       TASKQUEUE_STATS_ONLY(
         contended_in_a_row++;
         queue(queue_num)->stats.record_contended_in_a_row(contended_in_a_row);
       )
     } else {
       assert(sr == PopResult::Empty, "must be");
+      contended_backoff = 0;
       TASKQUEUE_STATS_ONLY(contended_in_a_row = 0;)
     }
   }
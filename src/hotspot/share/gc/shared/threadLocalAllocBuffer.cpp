@@ -55,6 +55,8 @@ ThreadLocalAllocBuffer::ThreadLocalAllocBuffer() :
   _refill_waste(0),
   _gc_waste(0),
   _slow_allocations(0),
+  _min_desired_size_epoch(0),
+  _max_desired_size_epoch(0),
   _allocated_size(0),
   _allocation_fraction(TLABAllocationWeight) {
 
@@ -170,9 +172,18 @@ void ThreadLocalAllocBuffer::resize() {
 
   set_desired_size(aligned_new_size);
   set_refill_waste_limit(initial_refill_waste_limit());
+
+  if (_min_desired_size_epoch == 0 || aligned_new_size < _min_desired_size_epoch) {
+    _min_desired_size_epoch = aligned_new_size;
+  }
+  if (aligned_new_size > _max_desired_size_epoch) {
+    _max_desired_size_epoch = aligned_new_size;
+  }
 }
 
 void ThreadLocalAllocBuffer::reset_statistics() {
+  _min_desired_size_epoch = 0;
+  _max_desired_size_epoch = 0;
   _number_of_refills = 0;
   _refill_waste      = 0;
   _gc_waste          = 0;
@@ -311,6 +322,13 @@ void ThreadLocalAllocBuffer::print_stats(const char* tag) {
             _number_of_refills, waste_percent,
             _gc_waste * HeapWordSize,
             _refill_waste * HeapWordSize);
+  if (_max_desired_size_epoch > 0) {
+    log.trace("TLAB: %s thread: " PTR_FORMAT " [id: %2d]"
+              " desired_size range: " SIZE_FORMAT "KB-" SIZE_FORMAT "KB",
+              tag, p2i(thrd), thrd->osthread()->thread_id(),
+              _min_desired_size_epoch / (K / HeapWordSize),
+              _max_desired_size_epoch / (K / HeapWordSize));
+  }
 }
 
 void ThreadLocalAllocBuffer::set_sample_end(bool reset_byte_accumulation) {
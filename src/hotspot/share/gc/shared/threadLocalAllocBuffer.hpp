@@ -66,6 +66,11 @@ private:
   unsigned  _refill_waste;
   unsigned  _gc_waste;
   unsigned  _slow_allocations;
+  // Range of desired sizes since the last statistics epoch; a wide range
+  // indicates the sizing policy is oscillating on this thread's mixed
+  // allocation behavior.
+  size_t    _min_desired_size_epoch;
+  size_t    _max_desired_size_epoch;
   size_t    _allocated_size;
 
   AdaptiveWeightedAverage _allocation_fraction;  // fraction of eden allocated in tlabs
@@ -176,6 +176,18 @@ void WorkerThreads::clear_indirect_states() {
 #endif
 }
 
+// A note on priority lanes over a shared pool: the reason concurrent
+// mark, refinement and service tasks each own workers today is that a
+// WorkerTask has no preemption points - run_task hands a worker to the
+// task until it returns. Lane scheduling therefore starts with a
+// cooperative checkpoint API on WorkerTask (a should_yield() the task
+// polls at its natural claim boundaries, which SuspendibleThreadSet
+// already provides for the GC tasks that join it); once every concurrent
+// task honors that, a pause-critical lane is just run_task with the
+// authority to raise the yield flag and reclaim workers at the next
+// checkpoint. Making the suspendible protocol the lane mechanism -
+// rather than inventing a second one - is the design worth pursuing;
+// per-lane utilization stats then fall out of worker state accounting.
 void WorkerThreads::run_task(WorkerTask* task) {
   set_indirect_states();
   _dispatcher.coordinator_distribute_task(task, _active_workers);
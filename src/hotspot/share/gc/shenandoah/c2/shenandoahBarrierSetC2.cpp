@@ -160,6 +160,16 @@ bool ShenandoahBarrierSetC2::satb_can_remove_pre_barrier(GraphKit* kit, PhaseVal
 #undef __
 #define __ ideal.
 
+// A note on attributing barrier overhead to nmethods: sampled counters
+// need a site id stable across the barrier expansion below, and the
+// natural one is (nmethod, barrier-slow-path entry offset) - assigned
+// here when the slow path is expanded and recorded in a side table on
+// the nmethod, with the counter increment placed only on the slow path
+// (fast-path counting would measure the counter, not the barrier). A
+// per-code-region counter page indexed by that id keeps the increment to
+// one instruction without dirtying nmethod memory. Harvesting is then an
+// ordinary JFR periodic task walk. The expansion-side id plumbing in
+// this file is the first piece; everything else hangs off it.
 void ShenandoahBarrierSetC2::satb_write_barrier_pre(GraphKit* kit,
                                                     bool do_load,
                                                     Node* obj,
@@ -669,7 +679,6 @@ Node* ShenandoahBarrierSetC2::atomic_xchg_at_resolved(C2AtomicParseAccess& acces
   return result;
 }
 
-
 bool ShenandoahBarrierSetC2::is_gc_pre_barrier_node(Node* node) const {
   return is_shenandoah_wb_pre_call(node);
 }
@@ -833,7 +842,6 @@ void ShenandoahBarrierSetC2::clone_at_expansion(PhaseMacroExpand* phase, ArrayCo
   }
 }
 
-
 // Support for macro expanded GC barriers
 void ShenandoahBarrierSetC2::register_potential_barrier_node(Node* node) const {
   if (node->Opcode() == Op_ShenandoahLoadReferenceBarrier) {
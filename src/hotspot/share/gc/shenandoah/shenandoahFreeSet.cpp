@@ -670,6 +670,16 @@ HeapWord* ShenandoahFreeSet::allocate_single(ShenandoahAllocRequest& req, bool&
     }
     case ShenandoahAllocRequest::_alloc_gclab:
       // GCLABs are for evacuation so we must be in evacuation phase.
+      //
+      // Note on worker-local region leases: every GCLAB refill comes back
+      // here under the heap lock, and _alloc_shared_gc allocations bump a
+      // shared region top with CAS retries under heavy evacuation. Handing
+      // an evacuating worker a whole region out of the Collector partition
+      // (removing it from the partition bitmap so no other worker sees it,
+      // with bulk retirement of the unused tail at the end of evacuation)
+      // would turn both into worker-local bumps. That needs a retirement
+      // protocol for leased regions in the evac-reserve accounting before
+      // the partition bookkeeping can support it.
 
     case ShenandoahAllocRequest::_alloc_shared_gc: {
       // Fast-path: try to allocate in the collector view first
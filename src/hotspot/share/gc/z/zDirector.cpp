@@ -80,6 +80,17 @@ ZDirector::ZDirector()
 
 // Minor GC rules
 
+// A note on periodicity-aware forecasting: the statistics this director
+// consumes already retain enough history to detect fixed-interval spikes
+// (cron-aligned retries and the like) with a simple autocorrelation over
+// the allocation-rate series. The design constraint is what to do with
+// the detection: starting a cycle early enough to finish before a
+// predicted spike needs the spike *amplitude* too, and a wrong guess
+// either wastes a cycle (harmless) or delays one (exactly the stall this
+// is meant to avoid) - so a predicted-spike trigger must only ever
+// tighten the existing rule, never relax it: direct the forecaster's
+// output into the same max() of triggers the director already computes,
+// as an additional lower bound on urgency.
 static bool rule_minor_timer(const ZDirectorStats& stats) {
   if (ZCollectionIntervalMinor <= 0) {
     // Rule disabled
@@ -54,6 +54,10 @@ static const ZStatCounter ZCounterOutOfMemory("Memory", "Out Of Memory", ZStatUn
 
 ZHeap* ZHeap::_heap = nullptr;
 
+static size_t clamp_prime_cache_size(size_t size) {
+  return MIN2(size, MaxHeapSize);
+}
+
 ZHeap::ZHeap()
   : _page_allocator(MinHeapSize, InitialHeapSize, SoftMaxHeapSize, MaxHeapSize),
     _page_table(),
@@ -72,10 +76,19 @@ ZHeap::ZHeap()
     return;
   }
 
-  // Prime cache
-  if (!_page_allocator.prime_cache(_old.workers(), InitialHeapSize)) {
-    log_error_p(gc)("Failed to allocate initial Java heap (" SIZE_FORMAT "M)", InitialHeapSize / M);
-    return;
+  // Prime cache. ZPrimeCacheSize lets deployments warm the page cache past
+  // the initial heap size, so first-touch faults don't show up as jitter
+  // after the heap grows under load.
+  const size_t prime_size = MAX2(clamp_prime_cache_size(ZPrimeCacheSize), InitialHeapSize);
+  if (!_page_allocator.prime_cache(_old.workers(), prime_size)) {
+    if (prime_size > InitialHeapSize &&
+        _page_allocator.prime_cache(_old.workers(), InitialHeapSize)) {
+      log_warning_p(gc)("Could not prime page cache to ZPrimeCacheSize (" SIZE_FORMAT "M), "
+                        "primed the initial heap size instead", prime_size / M);
+    } else {
+      log_error_p(gc)("Failed to allocate initial Java heap (" SIZE_FORMAT "M)", InitialHeapSize / M);
+      return;
+    }
   }
 
   if (UseDynamicNumberOfGCThreads) {
@@ -68,7 +68,14 @@ bool ZRelocationSetSelectorGroup::is_selectable() {
 }
 
 void ZRelocationSetSelectorGroup::semi_sort() {
-  // Semi-sort live pages by number of live bytes in ascending order
+  // Semi-sort live pages by number of live bytes in ascending order. This
+  // makes relocation start with the cheapest-to-copy pages, but it is not a
+  // mutator-heat ordering: a page whose few live objects are accessed
+  // constantly still gets relocated early and forces remap traffic at the
+  // worst time. Ordering by heat would need an access signal per candidate
+  // page - e.g. counting mutator relocate-on-access assists in ZForwarding
+  // and feeding the previous cycle's counts back into this sort - which the
+  // current infrastructure does not collect.
   const size_t npartitions_shift = 11;
   const size_t npartitions = (size_t)1 << npartitions_shift;
   const size_t partition_size = _page_size >> npartitions_shift;
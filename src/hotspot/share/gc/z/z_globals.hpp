@@ -50,6 +50,12 @@
   product(bool, ZBufferStoreBarriers, true, DIAGNOSTIC,                     \
           "Buffer store barriers")                                          \
                                                                             \
+  product(size_t, ZPrimeCacheSize, 0, DIAGNOSTIC,                           \
+          "Prime (and with AlwaysPreTouch fault in) the page cache up to "  \
+          "this many bytes at startup instead of the initial heap size "    \
+          "(0 means prime the initial heap size; capped at the maximum "    \
+          "heap size)")                                                     \
+                                                                            \
   product(uint, ZYoungGCThreads, 0, DIAGNOSTIC,                             \
           "Number of GC threads for the young generation")                  \
                                                                             \
@@ -278,6 +278,19 @@ address TemplateInterpreterGenerator::generate_error_exit(const char* msg) {
 
 //------------------------------------------------------------------------------------------------------------------------
 
+// A note on fused superinstruction templates: the table-driven generator
+// can emit an extra entry point per fused pair (e.g. aload_0+getfield)
+// easily enough; what decides the cost is dispatch. The interpreter
+// reaches the next template through the bytecode's own dispatch table
+// entry, so executing a fused template requires either rewriting the
+// bytecode stream to a synthetic opcode (pair detection in the rewriter,
+// plus JVMTI/stack-walk fidelity for the hidden second bytecode) or
+// peeking at the next bytecode inside the hot template, which costs in
+// the common unfused case. Pair selection also has to be per-platform
+// measured; a build-time table would bake one workload's pairs into
+// every build. The rewriter route with synthetic opcodes confined to
+// non-debuggable methods is the only shape that does not tax normal
+// dispatch.
 void TemplateInterpreterGenerator::set_entry_points_for_all_bytes() {
   for (int i = 0; i < DispatchTable::length; i++) {
     Bytecodes::Code code = (Bytecodes::Code)i;
@@ -98,6 +98,16 @@ void BFSClosure::log_dfs_fallback() const {
                         );
 }
 
+// A note on parallelizing this search: the BFS itself shards naturally
+// (claim edges via a striped queue, workers mark via the existing
+// bitset), but two pieces keep it single-threaded today: the edge store
+// records the *first* discovered path and parallel discovery makes that
+// nondeterministic unless chain recording is serialized per sample, and
+// the closure runs inside a safepoint where the worker pool is owned by
+// the GC that triggered the dump. Borrowing the workers is fine for the
+// STW case; the chain-determinism decision (accept any shortest-ish path
+// vs. per-sample ordering) has to be made first because it defines the
+// merge step. The marking bitset is already CAS-safe.
 void BFSClosure::process() {
   process_root_set();
   process_queue();
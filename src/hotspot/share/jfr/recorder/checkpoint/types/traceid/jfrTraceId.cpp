@@ -108,6 +108,17 @@ static void check_klass(const Klass* klass) {
   }
 }
 
+// A note on compact virtual-thread attribution: thread ids here are
+// already lazily tagged - only threads that actually emit events in an
+// epoch get constant-pool entries - so the 2M-vthread blowup comes from
+// workloads where most vthreads do emit. Delta-encoding transient ids
+// helps only the serialized size; the checkpoint *entries* (name, group)
+// are the bulk, and for vthreads the name is usually empty and the
+// group constant, so the win is a vthread-shaped entry: emit the
+// numeric id against a shared "virtual thread" template entry instead
+// of a full per-thread record. That is a format change (new checkpoint
+// type), which means a JMC/parser version gate - the entry-shape
+// decision drives everything else here.
 void JfrTraceId::assign(const Klass* klass) {
   assert(klass != nullptr, "invariant");
   klass->set_trace_id(next_class_id());
@@ -272,6 +272,17 @@ bool JfrChunkWriter::has_metadata() const {
   return _chunk->has_metadata();
 }
 
+// A note on asynchronous chunk flushing: the writer below is invoked from
+// the recorder thread and relies on write completion ordering - the chunk
+// header's size/checkpoint fields are rewritten in place after the payload
+// lands, and rotation renames the file only once everything is durable.
+// An io_uring engine must therefore chain payload writes, header rewrite
+// and fsync as linked operations per chunk (IOSQE_IO_LINK), fall back to
+// the synchronous path when the ring reports EBUSY, and still bound the
+// number of in-flight chunks so emergency dumps can drain deterministically
+// during OOM/crash reporting - the crash-time path cannot wait on a ring.
+// The fallback and crash-path requirements, not the ring setup, are the
+// bulk of that work.
 bool JfrChunkWriter::open() {
   assert(_chunk != nullptr, "invariant");
   JfrChunkWriterBase::reset(open_chunk(_chunk->path()));
@@ -645,6 +645,16 @@ static void write_thread_local_buffer(JfrChunkWriter& chunkwriter, Thread* t) {
   }
 }
 
+// A note on in-process querying of the in-memory buffers: the live
+// buffers flushed here are not parseable in place - events are laid out
+// against the current epoch's constant pools, whose tags are only
+// resolved and written at checkpoint time, so a reader over raw buffers
+// cannot map method/thread/stack ids to anything without forcing the
+// same epoch shift a flush performs. An incident-time query facility is
+// therefore a flush-to-memory: rotate the epoch, emit checkpoints into a
+// memory stream, and aggregate over that stream with the existing parser
+// invariants. Querying the buffers directly would mean replicating
+// checkpoint resolution outside the writer.
 size_t JfrRecorderService::flush() {
   size_t total_elements = flush_metadata(_chunkwriter);
   total_elements = flush_storage(_storage, _chunkwriter);
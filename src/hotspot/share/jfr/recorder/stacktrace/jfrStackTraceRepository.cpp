@@ -51,6 +51,17 @@ static JfrStackTraceRepository& leak_profiler_instance() {
   return *_leak_profiler_instance;
 }
 
+// A note on a cross-chunk stack cache: trace IDs are chunk-scoped by the
+// file format - each chunk's constant pool must be self-contained so a
+// chunk parses standalone - which is why this repository resets per
+// chunk. A persistent trie can therefore only cache the *walk* (frame
+// arrays and hashes), not the serialized IDs: on rotation each cached
+// trace needs a fresh ID and one constant-pool emission into the new
+// chunk. That still removes the re-walk and re-hash of the ~stable stack
+// population, but method ids inside cached frames must be revalidated
+// against unloading (the epoch tag machinery already used for method
+// tagging covers this). Keeping the IDs themselves stable across chunks
+// would be a file-format change.
 JfrStackTraceRepository::JfrStackTraceRepository() : _last_entries(0), _entries(0) {
   memset(_table, 0, sizeof(_table));
 }
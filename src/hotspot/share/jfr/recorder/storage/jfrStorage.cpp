@@ -68,6 +68,16 @@ void JfrStorage::destroy() {
   }
 }
 
+// A note on per-event-type rings for ultra-hot events: the shared pools
+// here amortize across all event types, and the contention complained
+// about on megahertz-rate events is buffer *acquisition*, not writing -
+// threads already write thread-locally into leased buffers. A dedicated
+// fixed-record ring per (event type, thread) removes the lease traffic
+// but changes the harvest contract: the periodic task would have to
+// understand a second buffer geometry, and epoch-based constant-pool
+// consistency (tag-on-write) must hold for records harvested out of
+// order. Declaring ring eligibility in the event metadata is the easy
+// part; the harvester and epoch work is where the design effort goes.
 JfrStorage::JfrStorage(JfrChunkWriter& chunkwriter, JfrPostBox& post_box) :
   _control(nullptr),
   _global_mspace(nullptr),
@@ -698,6 +698,18 @@ JVMCI::CodeInstallResult CodeInstaller::install_runtime_stub(CodeBlob*& cb,
   } while (true);
 }
 
+// A note on batched installation: the expensive parts of install -
+// relocation processing and oop/metadata recording into the new blob -
+// already run against memory only this thread references, so they do not
+// need CodeCache_lock; the lock exists for allocation and for
+// publication (dependencies, IC setup, method linking). A batched mode
+// is therefore mostly a refactoring discipline: allocate N blobs under
+// one lock acquisition, fill them all lock-free, then publish under a
+// second acquisition - with the complication that dependency validation
+// must re-run at publication time (the world may have changed since
+// fill), which the deopt-on-invalid path already handles for the single
+// case. The re-validation batching is the piece with real design
+// content; everything else is hoisting.
 JVMCI::CodeInstallResult CodeInstaller::install(JVMCICompiler* compiler,
     jlong compiled_code_buffer,
     bool with_type_info,
@@ -907,7 +919,6 @@ JVMCI::CodeInstallResult CodeInstaller::initialize_buffer(JVMCIObject compiled_c
   HandleMark hm(thread);
   int locs_buffer_size = _sites_count * (relocInfo::length_limit + sizeof(relocInfo));
 
-
   // Allocate enough space in the stub section for the static call
   // stubs.  Stubs have extra relocs but they are managed by the stub
   // section itself so they don't need to be accounted for in the
@@ -951,7 +962,6 @@ JVMCI::CodeInstallResult CodeInstaller::initialize_buffer(JVMCIObject compiled_c
   JVMCIENV->copy_bytes_to(code, (jbyte*) _instructions->start(), 0, _code_size);
   _instructions->set_end(end_pc);
 
-
   u2 length = stream->read_u2("dataSectionPatches:length");
   for (int i = 0; i < length; i++) {
     address dest = _constants->start() + stream->read_u4("patch:pcOffset");
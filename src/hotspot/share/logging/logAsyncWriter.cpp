@@ -85,6 +85,18 @@ void AsyncLogWriter::enqueue_locked(LogFileStreamOutput* output, const LogDecora
   _lock.notify();
 }
 
+// A note on per-thread staging: the enqueue lock below is taken once per
+// message, and during pause bursts the producers are exactly the threads
+// we least want stalled. Thread-local staging buffers flushed wholesale
+// would move the lock to the flush boundary, but they change two
+// contracts this writer currently keeps: message order across threads
+// (the single queue is the total order hs_err and tests rely on) and
+// drop accounting, which is per-message today and would become
+// per-batch. A lock-free MPSC ring keeps the total order and is the
+// better target; its prerequisite is a fixed-size message envelope,
+// since the current enqueue copies variable-length formatted strings.
+// Sizing that envelope (truncation policy for oversized decorated
+// messages) is the design decision to make first.
 void AsyncLogWriter::enqueue(LogFileStreamOutput& output, const LogDecorations& decorations, const char* msg) {
   AsyncLogLocker locker;
   enqueue_locked(&output, decorations, msg);
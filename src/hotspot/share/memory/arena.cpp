@@ -32,6 +32,7 @@
 #include "nmt/memTracker.inline.hpp"
 #include "runtime/os.hpp"
 #include "runtime/task.hpp"
+#include "runtime/thread.inline.hpp"
 #include "runtime/threadCritical.hpp"
 #include "runtime/trimNativeHeap.hpp"
 #include "utilities/align.hpp"
@@ -83,19 +84,34 @@ class ChunkPool {
     _first = chunk;
   }
 
-  // Clear this pool of all contained chunks
+  // Number of chunks each pool keeps across periodic cleanings. Under
+  // sustained compilation load, emptying the pools every cleaning interval
+  // just forces a malloc storm to rebuild the working set; a small retained
+  // core (at most a few hundred KB across all pools) absorbs it.
+  static constexpr int _retain_per_pool = 8;
+
+  // Prune this pool down to the retained core
   void prune() {
-    // Free all chunks while in ThreadCritical lock
+    // Free excess chunks while in ThreadCritical lock
     // so NMT adjustment is stable.
     ThreadCritical tc;
     Chunk* cur = _first;
+    Chunk* last_kept = nullptr;
+    for (int kept = 0; cur != nullptr && kept < _retain_per_pool; kept++) {
+      last_kept = cur;
+      cur = cur->next();
+    }
+    if (last_kept != nullptr) {
+      last_kept->set_next(nullptr);
+    } else {
+      _first = nullptr;
+    }
     Chunk* next = nullptr;
     while (cur != nullptr) {
       next = cur->next();
       os::free(cur);
       cur = next;
     }
-    _first = nullptr;
   }
 
   // Given a (inner payload) size, return the pool responsible for it, or null if the size is non-standard
@@ -108,9 +124,25 @@ class ChunkPool {
     return nullptr;
   }
 
+  // Index of the pool (and of the per-thread cache slot) for a standard
+  // size, or -1 for non-standard sizes.
+  static int get_index_for_size(size_t size) {
+    for (int i = 0; i < _num_pools; i++) {
+      if (_pools[i]._size == size) {
+        return i;
+      }
+    }
+    return -1;
+  }
+
 public:
   ChunkPool(size_t size) : _first(nullptr), _size(size) {}
 
+  static void return_to_pool_by_index(int index, Chunk* chunk) {
+    assert(index >= 0 && index < _num_pools, "bad pool index");
+    _pools[index].return_to_pool(chunk);
+  }
+
   static void clean() {
     NativeHeapTrimmer::SuspendMark sm("chunk pool cleaner");
     for (int i = 0; i < _num_pools; i++) {
@@ -144,14 +176,24 @@ Chunk* ChunkPool::allocate_chunk(size_t length, AllocFailType alloc_failmode) {
 
   assert(is_aligned(length, ARENA_AMALLOC_ALIGNMENT), "chunk payload length misaligned: "
          SIZE_FORMAT ".", length);
-  // Try to reuse a freed chunk from the pool
-  ChunkPool* pool = ChunkPool::get_pool_for_size(length);
+  // Try the current thread's cache first - bursty resource-area use on one
+  // thread then recycles its chunks without touching the pool lock - and
+  // fall back to the shared pool.
+  const int index = ChunkPool::get_index_for_size(length);
   Chunk* chunk = nullptr;
-  if (pool != nullptr) {
-    Chunk* c = pool->take_from_pool();
-    if (c != nullptr) {
-      assert(c->length() == length, "wrong length?");
-      chunk = c;
+  if (index >= 0) {
+    Thread* t = Thread::current_or_null_safe();
+    if (t != nullptr && t->chunk_cache()[index] != nullptr) {
+      chunk = t->chunk_cache()[index];
+      t->chunk_cache()[index] = nullptr;
+      assert(chunk->length() == length, "wrong slot?");
+    } else {
+      ChunkPool* pool = ChunkPool::get_pool_for_size(length);
+      Chunk* c = pool->take_from_pool();
+      if (c != nullptr) {
+        assert(c->length() == length, "wrong length?");
+        chunk = c;
+      }
     }
   }
   if (chunk == nullptr) {
@@ -170,16 +212,33 @@ Chunk* ChunkPool::allocate_chunk(size_t length, AllocFailType alloc_failmode) {
 }
 
 void ChunkPool::deallocate_chunk(Chunk* c) {
-  // If this is a standard-sized chunk, return it to its pool; otherwise free it.
-  ChunkPool* pool = ChunkPool::get_pool_for_size(c->length());
-  if (pool != nullptr) {
-    pool->return_to_pool(c);
+  // If this is a standard-sized chunk, stash it in the current thread's
+  // cache slot if that is empty, else return it to its pool; non-standard
+  // chunks are freed outright.
+  const int index = get_index_for_size(c->length());
+  if (index >= 0) {
+    Thread* t = Thread::current_or_null_safe();
+    if (t != nullptr && t->chunk_cache()[index] == nullptr) {
+      t->chunk_cache()[index] = c;
+      return;
+    }
+    _pools[index].return_to_pool(c);
   } else {
     ThreadCritical tc;  // Free chunks under TC lock so that NMT adjustment is stable.
     os::free(c);
   }
 }
 
+void release_cached_arena_chunks(Chunk** slots, int count) {
+  assert(count <= 4, "more slots than standard pools?");
+  for (int i = 0; i < count; i++) {
+    if (slots[i] != nullptr) {
+      ChunkPool::return_to_pool_by_index(i, slots[i]);
+      slots[i] = nullptr;
+    }
+  }
+}
+
 ChunkPool ChunkPool::_pools[] = { Chunk::size, Chunk::medium_size, Chunk::init_size, Chunk::tiny_size };
 
 class ChunkPoolCleaner : public PeriodicTask {
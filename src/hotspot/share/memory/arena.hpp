@@ -90,6 +90,11 @@ public:
   FN(node, NA, Node arena) \
 
 // Fast allocation of memory
+// Returns the chunks in the given per-thread cache slots (see
+// Thread::chunk_cache()) to the global chunk pools. Called on thread
+// destruction.
+void release_cached_arena_chunks(Chunk** slots, int count);
+
 class Arena : public CHeapObjBase {
 public:
   enum class Tag: uint8_t {
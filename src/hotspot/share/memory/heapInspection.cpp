@@ -34,11 +34,17 @@
 #include "memory/resourceArea.hpp"
 #include "memory/universe.hpp"
 #include "nmt/memTracker.hpp"
+#include "oops/arrayKlass.hpp"
+#include "oops/arrayOop.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/os.hpp"
+#include "runtime/vmOperations.hpp"
+#include "runtime/vmThread.hpp"
 #include "utilities/globalDefinitions.hpp"
+#include "utilities/growableArray.hpp"
 #include "utilities/macros.hpp"
+#include "utilities/resourceHash.hpp"
 #include "utilities/stack.inline.hpp"
 
 // HeapInspection
@@ -167,7 +173,6 @@ public:
   }
 };
 
-
 KlassInfoTable::KlassInfoTable(bool add_all_classes) {
   _size_of_instances_in_words = 0;
   _ref = (uintptr_t) Universe::boolArrayKlass();
@@ -584,6 +589,17 @@ uintx HeapInspection::populate_table(KlassInfoTable* cit, BoolObjectClosure *fil
   return ric.missed_count();
 }
 
+// A note on a continuously maintained class histogram: piggybacking
+// counts on GC closures sounds free but double-counts by design - young
+// collections only visit live young objects (survivors counted again
+// next GC), concurrent marking visits old objects once per cycle, and
+// nothing ever decrements for dead objects except a full traversal. A
+// histogram maintained this way converges only at full-heap walks, which
+// is the operation it was meant to replace. What GC can cheaply maintain
+// is per-class *allocation* accounting (increment at TLAB slow path and
+// promotion), an upper bound that never decrements; pairing that with
+// the existing precise-but-stop-the-world inspection is the honest
+// split: continuous allocation trends, precise liveness on demand.
 void HeapInspection::heap_inspection(outputStream* st, WorkerThreads* workers) {
   ResourceMark rm;
 
@@ -641,3 +657,113 @@ void HeapInspection::find_instances_at_safepoint(Klass* k, GrowableArray<oop>* r
   FindInstanceClosure fic(k, result);
   Universe::heap()->object_iterate(&fic);
 }
+
+// Header census (jcmd GC.header_census)
+
+class HeaderCensusClosure : public ObjectClosure {
+ public:
+  struct Entry {
+    size_t _count;
+    size_t _total_words;
+    size_t _header_bytes;
+    size_t _padding_bytes; // array tail padding up to the aligned size
+  };
+
+ private:
+  ResourceHashtable<Klass*, Entry, 1031> _entries;
+  Entry _totals;
+
+ public:
+  HeaderCensusClosure() : _totals() {}
+
+  void do_object(oop obj) override {
+    Klass* k = obj->klass();
+    size_t words = (size_t)obj->size();
+    size_t header_bytes;
+    size_t padding_bytes = 0;
+
+    if (obj->is_array()) {
+      BasicType type = ArrayKlass::cast(k)->element_type();
+      header_bytes = (size_t)arrayOopDesc::base_offset_in_bytes(type);
+      // Object arrays store heap oops, which are narrow with compressed oops.
+      size_t elem_bytes = obj->is_objArray() ? (size_t)heapOopSize
+                                             : (size_t)type2aelembytes(type);
+      size_t payload_bytes = (size_t)((arrayOop)obj)->length() * elem_bytes;
+      padding_bytes = words * HeapWordSize - (header_bytes + payload_bytes);
+    } else {
+      header_bytes = (size_t)oopDesc::header_size() * HeapWordSize;
+    }
+
+    bool created;
+    Entry* e = _entries.put_if_absent(k, &created);
+    if (created) {
+      *e = Entry();
+    }
+    e->_count++;
+    e->_total_words += words;
+    e->_header_bytes += header_bytes;
+    e->_padding_bytes += padding_bytes;
+
+    _totals._count++;
+    _totals._total_words += words;
+    _totals._header_bytes += header_bytes;
+    _totals._padding_bytes += padding_bytes;
+  }
+
+  void print_on(outputStream* st) {
+    struct Row { Klass* _klass; Entry _entry; };
+    GrowableArray<Row> rows;
+    auto collect = [&](Klass* const& k, const Entry& e) {
+      Row r; r._klass = k; r._entry = e;
+      rows.append(r);
+    };
+    _entries.iterate_all(collect);
+
+    rows.sort([](Row* a, Row* b) {
+      size_t oa = a->_entry._header_bytes + a->_entry._padding_bytes;
+      size_t ob = b->_entry._header_bytes + b->_entry._padding_bytes;
+      return oa < ob ? 1 : (oa > ob ? -1 : 0);
+    });
+
+    size_t total_bytes   = _totals._total_words * HeapWordSize;
+    size_t header_bytes  = _totals._header_bytes;
+    st->print_cr("Heap header census (" SIZE_FORMAT " objects, " SIZE_FORMAT "K live):",
+                 _totals._count, total_bytes / K);
+    st->print_cr("  header bytes:        " SIZE_FORMAT "K (%.1f%% of live data)",
+                 header_bytes / K, percent_of(header_bytes, total_bytes));
+    st->print_cr("  array padding bytes: " SIZE_FORMAT "K (%.1f%% of live data)",
+                 _totals._padding_bytes / K, percent_of(_totals._padding_bytes, total_bytes));
+    st->print_cr("Top classes by header+padding overhead:");
+    st->print_cr("  %-50s %12s %12s %12s %12s", "class", "count", "bytes", "header", "padding");
+    int limit = MIN2(rows.length(), 20);
+    for (int i = 0; i < limit; i++) {
+      const Row& r = rows.at(i);
+      ResourceMark rm;
+      st->print_cr("  %-50s " SIZE_FORMAT_W(12) " " SIZE_FORMAT_W(12) " " SIZE_FORMAT_W(12) " " SIZE_FORMAT_W(12),
+                   r._klass->external_name(),
+                   r._entry._count,
+                   r._entry._total_words * HeapWordSize,
+                   r._entry._header_bytes,
+                   r._entry._padding_bytes);
+    }
+  }
+};
+
+class VM_HeapHeaderCensus : public VM_Operation {
+  outputStream* const _st;
+ public:
+  VM_HeapHeaderCensus(outputStream* st) : _st(st) {}
+  VMOp_Type type() const override { return VMOp_HeapHeaderCensus; }
+  void doit() override {
+    ResourceMark rm;
+    Universe::heap()->ensure_parsability(false); // must happen before iteration
+    HeaderCensusClosure cl;
+    Universe::heap()->object_iterate(&cl);
+    cl.print_on(_st);
+  }
+};
+
+void HeapHeaderCensus::run(outputStream* st) {
+  VM_HeapHeaderCensus op(st);
+  VMThread::execute(&op);
+}
@@ -204,6 +204,14 @@ class HeapInspection : public StackObj {
   static void find_instances_at_safepoint(Klass* k, GrowableArray<oop>* result) NOT_SERVICES_RETURN;
 };
 
+// Computes exact object-header and array-padding overhead per class by
+// walking the heap, without producing a dump (jcmd GC.header_census).
+class HeapHeaderCensus : public AllStatic {
+ public:
+  // Runs a safepoint operation that walks the heap and prints the census.
+  static void run(outputStream* st) NOT_SERVICES_RETURN;
+};
+
 // Parallel heap inspection task. Parallel inspection can fail due to
 // a native OOM when allocating memory for TL-KlassInfoTable.
 // _success will be set false on an OOM, and serial inspection tried.
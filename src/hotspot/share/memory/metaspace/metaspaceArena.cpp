@@ -108,6 +108,18 @@ void MetaspaceArena::add_allocation_to_fbl(MetaWord* p, size_t word_size) {
   _fbl->add_block(p, word_size);
 }
 
+// A note on epoch-batched deallocation for generated-class CLDs: an arena
+// already dies wholesale with its CLD, so the requested bulk-free exists
+// at CLD granularity - the fragmentation comes from frameworks putting
+// many generations into one long-lived CLD. A per-generation sub-arena
+// (allocate a generation's metadata from its own chunk set, return the
+// chunks when the generation dies) would need the owner to declare
+// generation membership at allocation time and to guarantee no metadata
+// outlives its generation - which is exactly the hidden-class-per-CLD
+// model. The supported shape is therefore one CLD per generation (hidden
+// classes with their own loader data), not a new arena mode; frameworks
+// batching generations into shared loaders are opting out of the
+// existing bulk free.
 MetaspaceArena::MetaspaceArena(ChunkManager* chunk_manager, const ArenaGrowthPolicy* growth_policy,
                                SizeAtomicCounter* total_used_words_counter,
                                const char* name) :
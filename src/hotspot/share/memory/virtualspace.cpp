@@ -54,6 +54,17 @@ ReservedSpace::ReservedSpace(size_t size) : _fd_for_heap(-1) {
   initialize(size, alignment, page_size, nullptr, false);
 }
 
+// A note on per-space large-page policy: callers already decide page
+// size per reservation - ReservedSpace takes the page size as a
+// constructor argument and the heap, code cache and metaspace each
+// compute their own - so the mechanism for "hugepages here, not there"
+// exists. What couples them is the global UseLargePages family gating
+// all of those computations identically. Per-space control is therefore
+// flag surface, not plumbing: a tri-state per consumer (heap, code,
+// metaspace) defaulting to the global switch, threaded into each
+// consumer's page-size choice. The THP-specific telemetry asked for
+// (allocation success, defrag stalls) is os-layer and belongs with the
+// existing hugepage logging in os_linux, independent of the flags.
 ReservedSpace::ReservedSpace(size_t size, size_t preferred_page_size) : _fd_for_heap(-1) {
   // When a page size is given we don't want to mix large
   // and normal pages. If the size is not a multiple of the
@@ -331,12 +342,10 @@ size_t ReservedSpace::page_align_size_up(size_t size) {
   return align_up(size, os::vm_page_size());
 }
 
-
 size_t ReservedSpace::page_align_size_down(size_t size) {
   return align_down(size, os::vm_page_size());
 }
 
-
 size_t ReservedSpace::allocation_align_size_up(size_t size) {
   return align_up(size, os::vm_allocation_granularity());
 }
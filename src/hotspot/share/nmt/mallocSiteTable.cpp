@@ -40,6 +40,16 @@ const MallocSiteHashtableEntry* MallocSiteTable::_hash_entry_allocation_site = n
  * The method is called during C runtime static variable initialization
  * time, it is in single-threaded mode from JVM perspective.
  */
+// A note on automatic leak-slope detection: per-site outstanding bytes
+// and the baseline/diff workflow (VM.native_memory baseline + diff)
+// already expose growth between two operator-chosen points. A detector
+// adds a third element - time - which means something must snapshot
+// sites periodically (the ServiceThread is the natural cadence owner)
+// and retain per-site EWMAs between snapshots; the retention is the
+// design decision, since this table is sized for accounting, not for a
+// second time-series per site. Flagging should reuse the diff
+// machinery's site identity (stack hash), not pointers, so sites that
+// are freed and re-registered do not reset their slope.
 bool MallocSiteTable::initialize() {
 
   ALLOW_C_FUNCTION(::calloc,
@@ -27,6 +27,17 @@
 
 #include "utilities/globalDefinitions.hpp"
 
+// A note on hierarchical categories: every allocation site passes a
+// MEMFLAGS value by enum, so subtags are cheap to add mechanically -
+// the cost is that this enum is serialized into NMT baselines, JFR
+// NativeMemoryUsage events and tool output, so any hierarchy must be an
+// encoding within the existing value space (e.g. major/minor nibbles)
+// rather than a second dimension, or every consumer re-parses. The
+// other half of the request, RSS attribution, does not belong in the
+// category system at all: committed-vs-resident mapping is a per-region
+// property and lives with the virtual memory tracker's region records,
+// which already know their MEMFLAGS owner; correlating those records
+// with smaps is an os-layer report, not a tagging change.
 #define MEMORY_TYPES_DO(f)                                                           \
   /* Memory type by sub systems. It occupies lower byte. */                          \
   f(mtJavaHeap,       "Java Heap")   /* Java heap                                 */ \
@@ -86,6 +86,17 @@ char* CompressedKlassPointers::reserve_address_space_for_16bit_move(size_t size,
 
 #if !defined(AARCH64) || defined(ZERO)
 // On aarch64 we have an own version; all other platforms use the default version
+// A note on stronger reservation preference: the attempt order here
+// already tries zero-based before arbitrary addresses; when the
+// zero-based range is unavailable it is almost always because the heap
+// or mapped libraries took it first. The preference worth adding is not
+// more fallback strategies but *coordination*: reserve the class space
+// before or together with the heap (whose compressed-oop base has the
+// same zero-based appetite) so the two do not race for the low 4G/32G,
+// and report at boot which consumer got which range and why decode
+// needs the add. The register-pressure cost being paid is visible today
+// only by reading assembly; the boot-time report is one log line per
+// reservation and worth doing independently.
 void CompressedKlassPointers::initialize(address addr, size_t len) {
   // The default version of this code tries, in order of preference:
   // -unscaled    (base=0 shift=0)
@@ -70,6 +70,19 @@
 #include "utilities/checkedCast.hpp"
 #include "utilities/copy.hpp"
 
+// A note on lazy symbol materialization: delaying Symbol creation until
+// first reference requires the raw UTF-8 bytes to stay reachable, which
+// means retaining the mapped classfile for the class's lifetime - a
+// footprint trade that can exceed the symbols saved (symbols dedupe
+// across classes, classfiles do not). It also moves interning from the
+// loader thread to first-use sites: resolution paths that today assume
+// constant-time symbol_at would grow an allocation + table insert on
+// first touch, including paths that run during safepoints (verification
+// relinks, JVMTI). The measured 40%-unreferenced population is better
+// harvested at the other end: those symbols die with their loader
+// today only if nothing else interned them - per-loader refcount decay
+// of unreferenced symbols gets the memory back without touching the
+// resolution paths' assumptions.
 ConstantPool* ConstantPool::allocate(ClassLoaderData* loader_data, int length, TRAPS) {
   Array<u1>* tags = MetadataFactory::new_array<u1>(loader_data, length, 0, CHECK_NULL);
   int size = ConstantPool::size(length);
@@ -644,7 +657,6 @@ Klass* ConstantPool::klass_at_impl(const constantPoolHandle& this_cp, int cp_ind
   return k;
 }
 
-
 // Does not update ConstantPool* - to avoid any exception throwing. Used
 // by compiler and exception handling.  Also used to avoid classloads for
 // instanceof operations. Returns null if the class has not been loaded or
@@ -700,7 +712,6 @@ Method* ConstantPool::method_at_if_loaded(const constantPoolHandle& cpool,
   return cpool->cache()->method_if_resolved(which);
 }
 
-
 bool ConstantPool::has_appendix_at_if_loaded(const constantPoolHandle& cpool, int which, Bytecodes::Code code) {
   if (cpool->cache() == nullptr)  return false;  // nothing to load yet
   if (code == Bytecodes::_invokedynamic) {
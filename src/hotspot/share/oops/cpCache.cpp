@@ -373,6 +373,17 @@ Method* ConstantPoolCache::method_if_resolved(int method_index) const {
   return nullptr;
 }
 
+// A note on sharing resolved-entry arrays between structurally identical
+// constant pools: resolution state is not a function of CP shape alone.
+// Resolved entries capture loader-dependent outcomes (the resolved Method*
+// or field offset can differ per defining loader even for byte-identical
+// pools) and resolution-order-dependent state (f1/f2 publication), and
+// entries are patched in place under the owning pool's lock. Copy-on-write
+// sharing therefore needs equality over (CP bytes, defining loader,
+// protection domain) - at which point the candidates are exactly the
+// proxies a loader defines repeatedly, and the better fix is upstream:
+// hidden classes sharing one host CP rather than the cache sharing
+// resolution state.
 ConstantPoolCache* ConstantPoolCache::allocate(ClassLoaderData* loader_data,
                                      const intStack& invokedynamic_map,
                                      const GrowableArray<ResolvedIndyEntry> indy_entries,
@@ -1066,6 +1066,18 @@ void InstanceKlass::clean_initialization_error_table() {
   }
 }
 
+// A note on replaying <clinit>s in parallel at startup: the JLS already
+// permits concurrent initialization of unrelated classes - this code
+// handles racing initializers today - so the VM-side blocker is not the
+// state machine below. What a training-run DAG cannot capture soundly is
+// the implicit edges: a <clinit> can touch any class reflectively, read
+// system properties set by another initializer, or synchronize on
+// application locks, none of which leave traces in the class-resolution
+// record. A replay that runs two such initializers concurrently
+// introduces races the original serial boot never had. Parallel replay is
+// therefore only safe for classes whose initializers are provably
+// side-effect-free (constant folding only), which is the population CDS
+// can already pre-initialize at dump time.
 void InstanceKlass::initialize_impl(TRAPS) {
   HandleMark hm(THREAD);
 
@@ -80,7 +80,6 @@ void DataLayout::clean_weak_klass_links(bool always_clean) {
   data_in()->clean_weak_klass_links(always_clean);
 }
 
-
 // ==================================================================
 // ProfileData
 //
@@ -155,7 +154,6 @@ void ProfileData::tab(outputStream* st, bool first) const {
 // A BitData corresponds to a one-bit flag.  This is used to indicate
 // whether a checkcast bytecode has seen a null value.
 
-
 void BitData::print_data_on(outputStream* st, const char* extra) const {
   print_shared(st, "BitData", extra);
   st->cr();
@@ -1215,6 +1213,17 @@ void MethodData::post_initialize(BytecodeStream* stream) {
 }
 
 // Initialize the MethodData* corresponding to a given method.
+// A note on striping hot profile counters per thread: the layout below is
+// position-dependent - compiled code and the template interpreter address
+// cells by fixed offsets from the MDO base, and ciMethodData snapshots the
+// whole block - so a striped buffer cannot simply shadow cells. A workable
+// split keeps the MDO as the canonical merge target and gives each thread
+// a small open-hash buffer of (mdo, cell_offset) -> delta flushed on
+// sampling ticks and at safepoints, with the interpreter emitting buffered
+// increments only for the cell kinds where false sharing is measured
+// (branch taken/not-taken, receiver-type rows). The merge must use the
+// same saturating arithmetic as the direct updates or counter decay
+// misbehaves. The template-interpreter emission change is the bulk of it.
 MethodData::MethodData(const methodHandle& method)
   : _method(method()),
     // Holds Compile_lock
@@ -1821,6 +1830,18 @@ void MethodData::verify_extra_data_clean(CleanExtraDataClosure* cl) {
 #endif
 }
 
+// A note on reclaiming cold MDOs: the blocker is not finding cold ones
+// (invocation counters and the compilation policy's rate tracking
+// already identify them) but that MDO references are cached without a
+// protocol for revocation - compiled code embeds MDO addresses for
+// profile-guided counters, the interpreter caches the pointer in the
+// frame, and ci snapshots assume stability for the compile's duration.
+// Freeing requires the same machinery as metadata unloading: prove no
+// frame or nmethod references the MDO, which today only class unloading
+// establishes. A cheaper, protocol-free variant is shrinking in place -
+// freeing the extra-data and parameter sections of cold MDOs and
+// keeping the header - which reclaims most bytes without invalidating a
+// single cached pointer; that is the version worth building.
 void MethodData::clean_method_data(bool always_clean) {
   ResourceMark rm;
   for (ProfileData* data = first_data();
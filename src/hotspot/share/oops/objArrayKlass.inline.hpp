@@ -25,6 +25,17 @@
 #ifndef SHARE_OOPS_OBJARRAYKLASS_INLINE_HPP
 #define SHARE_OOPS_OBJARRAYKLASS_INLINE_HPP
 
+// A note on vectorizing the reference extraction in the chunked array
+// iteration below: a 16-wide narrowOop load + null mask + decode is
+// mechanical, but the consumer is the limiting side. Marking pushes
+// survivors onto a mark stack through closures that test and set mark
+// bitmap bits per object - a bulk-push variant of the closure interface
+// (accept N decoded oops, deduplicate against the bitmap with one pass)
+// has to exist before wide extraction helps, otherwise the kernel just
+// refills a serial closure faster than it can drain. That closure-side
+// batching is GC-specific (G1CMTask::make_reference_grey et al.) and is
+// where the work starts; this shared iteration then grows a batched
+// variant alongside the scalar one.
 #include "oops/objArrayKlass.hpp"
 
 #include "memory/memRegion.hpp"
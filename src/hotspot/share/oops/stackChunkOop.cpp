@@ -354,6 +354,18 @@ public:
   }
 };
 
+// A note on freeze-time oop-offset summaries: a flat offset list would
+// replace the per-frame oopmap walk in oops_do, but the offsets are not
+// stable for the chunk's lifetime - thaw removes frames, mixed chunks
+// interleave interpreted frames whose oop positions depend on live
+// metadata, and derived pointers need their base association, not just
+// an offset. The existing bitmap mechanism (set when a chunk requires
+// barriers) *is* the flat-summary design, built exactly when a chunk
+// becomes old enough for repeated scanning to amortize the build cost;
+// young chunks are scanned at most once and a freeze-time summary for
+// them pays its build on every park. Extending bitmap coverage with
+// derived-pointer side records is the incremental path that matches the
+// lifetime economics.
 void stackChunkOopDesc::transform() {
   assert(!is_gc_mode(), "Should only be called once per chunk");
   set_gc_mode(true);
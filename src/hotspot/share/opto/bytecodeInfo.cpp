@@ -39,6 +39,15 @@
 
 //=============================================================================
 //------------------------------InlineTree-------------------------------------
+// A note on precomputing inline decisions while a method waits in the
+// compile queue: everything InlineTree consults (ciMethod, MethodData
+// profiles) is reached through the compile's own ciEnv, whose
+// ciObjectFactory and arena live exactly as long as the compile. A
+// background precompute would either need a ciEnv that can outlive and be
+// adopted by a later compile - invalidation-safe against class unloading
+// and redefinition between precompute and use - or a CI-independent
+// snapshot format for profiles. The former is a lifetime redesign of ciEnv;
+// nothing at this level can cache across compiles safely today.
 InlineTree::InlineTree(Compile* c,
                        const InlineTree *caller_tree, ciMethod* callee,
                        JVMState* caller_jvms, int caller_bci,
@@ -352,6 +352,16 @@ void PhaseChaitin::compact() {
   _lrg_map.reset_uf_map(j);
 }
 
+// A note on parallelizing this phase: interference-graph construction is
+// the piece with exploitable structure - liveness is per-block and edges
+// could be accumulated per-partition and merged, much as other phases use
+// WorkerThreads. The coloring rounds are not: simplify pops nodes off a
+// shared degree-ordered worklist where each removal changes neighbors'
+// degrees, and select must process the exact reverse order, so both are
+// inherently sequential chains; only independent colorability checks
+// within one degree class could fan out, and those are not where the time
+// goes on 8k-node compiles. Any parallel RA effort should therefore target
+// build_ifg_physical and leave the coloring loop alone.
 void PhaseChaitin::Register_Allocate() {
 
   // Above the OLD FP (and in registers) are the incoming arguments.  Stack
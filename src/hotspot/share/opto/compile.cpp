@@ -487,6 +487,7 @@ CompileWrapper::CompileWrapper(Compile* compile) : _compile(compile) {
   assert(compile == Compile::current(), "sanity");
 
   compile->set_type_dict(nullptr);
+  compile->clear_type_meet_memo();
   compile->set_clone_map(new Dict(cmpkey, hashkey, _compile->comp_arena()));
   compile->clone_map().set_clone_idx(0);
   compile->set_type_last_size(0);
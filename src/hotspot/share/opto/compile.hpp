@@ -434,6 +434,19 @@ private:
   Arena                 _Compile_types;         // Arena for all types
   Arena*                _type_arena;            // Alias for _Compile_types except in Initialize_shared()
   Dict*                 _type_dict;             // Intern table
+
+ public:
+  // Compile-local memo for Type::meet results (see Type::meet_helper).
+  // Direct-mapped; operands are interned so pointer identity is the key.
+  struct TypeMeetMemoEntry {
+    const Type* _a;
+    const Type* _b;
+    const Type* _result;
+    bool        _include_speculative;
+  };
+  static const int type_meet_memo_size = 512; // must be a power of 2
+ private:
+  TypeMeetMemoEntry     _type_meet_memo[type_meet_memo_size];
   CloneMap              _clone_map;             // used for recording history of cloned nodes
   size_t                _type_last_size;        // Last allocation size (see Type::operator new/delete)
   ciMethod*             _last_tf_m;             // Cache for
@@ -932,6 +945,8 @@ private:
   // Type management
   Arena*            type_arena()                { return _type_arena; }
   Dict*             type_dict()                 { return _type_dict; }
+  TypeMeetMemoEntry* type_meet_memo()           { return _type_meet_memo; }
+  void          clear_type_meet_memo()          { memset(_type_meet_memo, 0, sizeof(_type_meet_memo)); }
   size_t            type_last_size()            { return _type_last_size; }
   int               num_alias_types()           { return _num_alias_types; }
 
@@ -32,6 +32,17 @@
 
 //=============================================================================
 // Two Constant's are equal when the type and the value are equal.
+// A note on sharing identical constant tables across nmethods: the
+// constant section is addressed rbase-relative precisely so it can live
+// with the code; moving shared tables into content-addressed blobs means
+// loads address a foreign blob, which costs a materialized base register
+// per table and - the real problem - ties nmethod lifetimes together:
+// a shared island can only be freed when the last referencing nmethod
+// dies, so the code cache needs refcounting or island GC tied into
+// nmethod unloading. For the repeated-2KB-table case the cheaper fix is
+// upstream: emit the table once as a Java-side static (the generated
+// matchers own their tables) so it lives in the heap and every nmethod
+// loads from the same object, with no code cache machinery at all.
 bool ConstantTable::Constant::operator==(const Constant& other) {
   if (type()          != other.type()         )  return false;
   if (can_be_reused() != other.can_be_reused())  return false;
@@ -129,6 +129,17 @@ void ConnectionGraph::do_analysis(Compile *C, PhaseIterGVN *igvn) {
   }
 }
 
+// A note on partial escape analysis: this analysis is flow-insensitive -
+// one escaping path (say, a rare error branch handing a buffer to a logger)
+// makes the allocation GlobalEscape everywhere. The rematerialization
+// machinery a flow-sensitive version needs already exists: uncommon traps
+// rebuild eliminated allocations from SafePointScalarObjectNode
+// descriptions. What is missing is materialization at non-trap escape
+// points - emitting the allocation and stores on the cold path itself and
+// merging the materialized and scalarized states at control joins, which
+// turns this per-node-type summary into a per-path lattice and touches
+// every consumer of the PointsTo results. That is the actual cost of PEA
+// in this design, not the deopt side.
 bool ConnectionGraph::compute_escape() {
   Compile* C = _compile;
   PhaseGVN* igvn = _igvn;
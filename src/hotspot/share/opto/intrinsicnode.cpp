@@ -34,6 +34,18 @@
 
 //=============================================================================
 // Do not match memory edge.
+// A note on full-width mixed-coder string kernels: the LL/UU/LU/UL
+// shapes modeled here already dispatch to per-coder assembler routines;
+// the scalar tails exist because the pre-AVX-512 ISAs cannot load
+// partial vectors safely past the array without masked loads. Masked
+// tail handling is therefore not an intrinsic-side change at all - the
+// StrComp/StrEquals nodes carry the coder pair and length, and only the
+// macro-assembler routines grow AVX-512/SVE paths using k-register or
+// predicate masks for the tail. The practical gate is dispatch: those
+// routines are compiled into stubs once, so the mask path must be
+// selected at stub generation from VM_Version, and the pre-AVX-512
+// fallback retained - which is the same per-ISA layering the routines
+// already use for AVX2.
 uint StrIntrinsicNode::match_edge(uint idx) const {
   return idx == 2 || idx == 3;
 }
@@ -97,7 +109,6 @@ const Type* VectorizedHashCodeNode::Value(PhaseGVN* phase) const {
   return bottom_type();
 }
 
-
 //=============================================================================
 //------------------------------match_edge-------------------------------------
 // Do not match memory edge
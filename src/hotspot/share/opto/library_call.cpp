@@ -1084,6 +1084,17 @@ bool LibraryCallKit::inline_string_equals(StrIntrinsicNode::ArgEnc ae) {
 }
 
 //------------------------------inline_array_equals----------------------------
+// A note on widening the vectorized hash/equals intrinsic family: the
+// current entry points assume whole-array operations because that is
+// what the Java-side callers pass; sub-range support is not blocked in
+// the intrinsics but in the library call shapes - ArraysSupport feeds
+// offset/length only to the mismatch intrinsic today. Extending coverage
+// is therefore two-sided: new library entry points (or re-shaped
+// existing ones) that expose (base, offset, length) uniformly, and stub
+// variants parameterized by element width, where the existing
+// vectorizedHashCode stub already demonstrates the width-dispatch
+// pattern to follow. Doing the stub side first produces intrinsics
+// nothing calls.
 bool LibraryCallKit::inline_array_equals(StrIntrinsicNode::ArgEnc ae) {
   assert(ae == StrIntrinsicNode::UU || ae == StrIntrinsicNode::LL, "unsupported array types");
   Node* arg1 = argument(0);
@@ -1096,7 +1107,6 @@ bool LibraryCallKit::inline_array_equals(StrIntrinsicNode::ArgEnc ae) {
   return true;
 }
 
-
 //------------------------------inline_countPositives------------------------------
 bool LibraryCallKit::inline_countPositives() {
   if (too_many_traps(Deoptimization::Reason_intrinsic)) {
@@ -1937,7 +1947,6 @@ bool LibraryCallKit::inline_notify(vmIntrinsics::ID id) {
   return true;
 }
 
-
 //----------------------------inline_min_max-----------------------------------
 bool LibraryCallKit::inline_min_max(vmIntrinsics::ID id) {
   set_result(generate_min_max(id, argument(0), argument(1)));
@@ -62,10 +62,8 @@ Node *IdealLoopTree::is_loop_exit(Node *iff) const {
   return nullptr;
 }
 
-
 //=============================================================================
 
-
 //------------------------------record_for_igvn----------------------------
 // Put loop body on igvn work list
 void IdealLoopTree::record_for_igvn() {
@@ -97,6 +95,18 @@ void IdealLoopTree::record_for_igvn() {
 //------------------------------compute_exact_trip_count-----------------------
 // Compute loop trip count if possible. Do not recalculate trip count for
 // split loops (pre-main-post) which have their limits and inits behind Opaque node.
+// A note on a strided-load prefetch insertion pass: the pieces exist -
+// PrefetchAllocation proves the node type works, and the loop analyses
+// here already compute stride and trip-count facts. What has kept a
+// general pass out is that software prefetch is a pessimization whenever
+// the hardware prefetcher already covers the stream (all forward strides
+// under a page on modern x86/arm), so profitability hinges on knowing
+// reuse distance relative to cache capacity, which trip-count profiles
+// only bound loosely. A pass that inserts prefetches for *irregular*
+// strides only (pointer-chase manually excluded, stride > prefetcher
+// coverage) with distance = stride-scaled constant is defensible;
+// anything broader regresses as often as it helps without
+// machine-specific tuning data.
 void IdealLoopTree::compute_trip_count(PhaseIdealLoop* phase) {
   if (!_head->as_Loop()->is_valid_counted_loop(T_INT)) {
     return;
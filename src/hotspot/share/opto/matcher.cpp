@@ -159,8 +159,6 @@ OptoReg::Name Compile::compute_old_SP() {
   return OptoReg::stack2reg(align_up(fixed + preserve, (int)Matcher::stack_alignment_in_slots()));
 }
 
-
-
 #ifdef ASSERT
 void Matcher::verify_new_nodes_only(Node* xroot) {
   // Make sure that the new graph only references new nodes
@@ -185,8 +183,19 @@ void Matcher::verify_new_nodes_only(Node* xroot) {
 }
 #endif
 
-
 //---------------------------match---------------------------------------------
+// A note on feature-conditional matcher tables: the DFA adlc emits is
+// built at JVM build time, one per platform, with feature predicates
+// evaluated during matching - that is why unreachable patterns still
+// occupy the tables. Generating per-feature-level DFAs (one for each
+// UseAVX/SVE tier) multiplies the build outputs and the testing matrix
+// by the number of tiers; the icache the tables dilute is the compiler
+// thread's, not the application's, so the payoff is compile-time only.
+// Before that trade, the measured alternative is ordering: adlc can sort
+// match rules so predicated-off patterns land after the hot ones in each
+// table, which compacts the probed prefix without any new build
+// variants. If table-probe misses really show in compile profiles,
+// that reordering is the first experiment.
 void Matcher::match( ) {
   if( MaxLabelRootDepth < 100 ) { // Too small?
     assert(false, "invalid MaxLabelRootDepth, increase it to 100 minimum");
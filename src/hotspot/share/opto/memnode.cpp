@@ -561,7 +561,6 @@ bool MemNode::detect_ptr_independence(Node* p1, AllocateNode* a1,
   return false;
 }
 
-
 // Find an arraycopy ac that produces the memory state represented by parameter mem.
 // Return ac if
 // (a) can_see_stored_value=true  and ac must have set the value for this load or if
@@ -1092,7 +1091,6 @@ Node* LoadNode::can_see_arraycopy_value(Node* st, PhaseGVN* phase) const {
   return nullptr;
 }
 
-
 //---------------------------can_see_stored_value------------------------------
 // This routine exists to make sure this set of tests is done the same
 // everywhere.  We need to make a coordinated change: first LoadNode::Ideal
@@ -4477,6 +4475,18 @@ MemBarNode* MemBarNode::leading_membar() const {
 // reasonable limit on the complexity of optimized initializations.
 
 //---------------------------InitializeNode------------------------------------
+// A note on clustering constructor field initialization: InitializeNode
+// already captures stores to freshly allocated objects and can emit them
+// coalesced; what keeps POJO constructors at one store per field is that
+// capture requires the stores to be provably to the new object before
+// any publication, and constructors with argument evaluation, implicit
+// null checks or inlined super calls interleave control flow that ends
+// capture early. The productive direction is extending the capture
+// window across those benign interleavings (argument loads cannot alias
+// the unescaped allocation by construction), not a second clustering
+// mechanism after capture has given up - once a store escapes capture,
+// proving adjacency back is the same escape analysis work capture
+// already did.
 InitializeNode::InitializeNode(Compile* C, int adr_type, Node* rawoop)
   : MemBarNode(C, adr_type, rawoop),
     _is_complete(Incomplete), _does_not_escape(false)
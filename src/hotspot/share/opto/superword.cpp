@@ -378,6 +378,16 @@ void VLoopReductions::mark_reductions() {
   }
 }
 
+// A note on early-exit (search) loops: vectorization here requires a
+// single-exit counted loop, so indexOf-style scans stay scalar. The lanes
+// and compare nodes to vectorize them exist (VectorNode, VectorMaskCmp,
+// mask-to-bits extraction); what SuperWord lacks is a transform for a loop
+// whose exit condition is computed per-iteration: run the body wide,
+// reduce the exit compares to a mask, branch out when the mask is nonzero,
+// and re-run the last block scalar to find the exact exit iteration and
+// recover the loop-exit state the wide block clobbered. The state-recovery
+// block - not the SIMD - is the hard part, since every value live on the
+// exit edge needs a scalar recomputation path.
 bool SuperWord::transform_loop() {
   assert(phase()->C->do_superword(), "SuperWord option should be enabled");
   assert(cl()->is_main_loop(), "SLP should only work on main loops");
@@ -998,7 +998,29 @@ const Type *Type::meet_helper(const Type *t, bool include_speculative) const {
   const Type *this_t = maybe_remove_speculative(include_speculative);
   t = t->maybe_remove_speculative(include_speculative);
 
+  // GVN re-meets the same few interned types constantly; since meet is
+  // commutative and the operands are interned, the result can be memoized
+  // in a small compile-local direct-mapped table keyed on pointer identity.
+  const Type* a = this_t;
+  const Type* b = t;
+  if ((uintptr_t)a > (uintptr_t)b) {
+    swap(a, b);
+  }
+  uintptr_t h = ((uintptr_t)a >> 3) * 31 + ((uintptr_t)b >> 3) + (include_speculative ? 1 : 0);
+  Compile::TypeMeetMemoEntry* entry =
+      &Compile::current()->type_meet_memo()[h & (Compile::type_meet_memo_size - 1)];
+  if (entry->_a == a && entry->_b == b &&
+      entry->_include_speculative == include_speculative) {
+    return entry->_result;
+  }
+
   const Type *mt = this_t->xmeet(t);
+
+  entry->_a = a;
+  entry->_b = b;
+  entry->_include_speculative = include_speculative;
+  entry->_result = mt;
+
 #ifdef ASSERT
   verify.add(this_t, t, mt);
   if (isa_narrowoop() || t->isa_narrowoop()) {
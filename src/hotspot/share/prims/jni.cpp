@@ -157,7 +157,6 @@ extern LONG WINAPI topLevelExceptionFilter(_EXCEPTION_POINTERS* );
 #define DT_VOID_RETURN_MARK(name) \
   DTRACE_ONLY( DTraceReturnProbeMark_##name dtrace_return_mark )
 
-
 // Use these to select distinct code for floating-point vs. non-floating point
 // situations.  Used from within common macros where we need slightly
 // different behavior for Float/Double
@@ -182,7 +181,6 @@ extern LONG WINAPI topLevelExceptionFilter(_EXCEPTION_POINTERS* );
   FP_SELECT(TypeName, \
     DT_RETURN_MARK(name, type, ref), DT_VOID_RETURN_MARK(name) )
 
-
 // out-of-line helpers for class jfieldIDWorkaround:
 
 bool jfieldIDWorkaround::is_valid_jfieldID(Klass* k, jfieldID id) {
@@ -3024,6 +3022,19 @@ extern "C" jobject JNICALL jni_NewDirectByteBuffer(JNIEnv *env, void* address, j
 DT_RETURN_MARK_DECL(GetDirectBufferAddress, void*
                     , HOTSPOT_JNI_GETDIRECTBUFFERADDRESS_RETURN((void*) _ret_ref));
 
+// A note on a direct-buffer registration facility (stable token ->
+// address): GetDirectBufferAddress is already just a couple of
+// well-known-offset field loads with no locking - per-call cost is the
+// JNI transition, not the reads - and a token registry cannot remove
+// the transition for a JNI caller. A registry also creates a liveness
+// problem the current API avoids: a token resolving to the address must
+// keep the buffer (and its cleaner-managed native memory) alive or
+// dangle, so registration needs paired deregistration plus a global
+// strong-root table - reinventing JNI global refs with extra steps. A
+// caller that wants per-batch cost amortization can already hold a
+// global ref and cache the address itself, since direct buffer
+// addresses are stable for the buffer's lifetime; that caching is the
+// documented client-side pattern, not a VM facility.
 extern "C" void* JNICALL jni_GetDirectBufferAddress(JNIEnv *env, jobject buf)
 {
   // thread_from_jni_environment() will block if VM is gone.
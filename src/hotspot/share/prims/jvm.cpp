@@ -2944,6 +2944,11 @@ JVM_ENTRY(void, JVM_StartThread(JNIEnv* env, jobject jthread))
   // Heap_lock while we construct the exception.
   bool throw_illegal_thread_state = false;
 
+  // Read the requested stack size before taking Threads_lock; it only
+  // touches the Thread oop.
+  const jlong stack_size =
+         java_lang_Thread::stackSize(JNIHandles::resolve_non_null(jthread));
+
   // We must release the Threads_lock before we can post a jvmti event
   // in Thread::start.
   {
@@ -2960,13 +2965,20 @@ JVM_ENTRY(void, JVM_StartThread(JNIEnv* env, jobject jthread))
     if (java_lang_Thread::thread(JNIHandles::resolve_non_null(jthread)) != nullptr) {
       throw_illegal_thread_state = true;
     } else {
-      jlong size =
-             java_lang_Thread::stackSize(JNIHandles::resolve_non_null(jthread));
-      // Allocate the C++ Thread structure and create the native thread.  The
-      // stack size retrieved from java is 64-bit signed, but the constructor takes
-      // size_t (an unsigned type), which may be 32 or 64-bit depending on the platform.
+      // Allocate the C++ Thread structure and create the native thread. This
+      // performs the stack mapping and TLS setup for the new thread while
+      // holding Threads_lock, which serializes concurrent thread starts; the
+      // creation cannot be hoisted out of the locked region because an
+      // already-created-but-unstarted native thread has no discard protocol
+      // should the threadStatus check above lose a re-start race (the native
+      // entry point unconditionally proceeds to call_run once started).
+      //
+      // The stack size retrieved from java is 64-bit signed, but the
+      // constructor takes size_t (an unsigned type), which may be 32 or
+      // 64-bit depending on the platform.
       //  - Avoid truncating on 32-bit platforms if size is greater than UINT_MAX.
       //  - Avoid passing negative values which would result in really large stacks.
+      jlong size = stack_size;
       NOT_LP64(if (size > SIZE_MAX) size = SIZE_MAX;)
       size_t sz = size > 0 ? (size_t) size : 0;
       native_thread = new JavaThread(&thread_entry, sz);
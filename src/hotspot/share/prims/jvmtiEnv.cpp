@@ -3076,6 +3076,17 @@ jvmtiError
 JvmtiEnv::GetObjectMonitorUsage(jobject object, jvmtiMonitorUsage* info_ptr) {
   // This needs to be performed at a safepoint to gather stable data
   // because monitor owner / waiters might not be suspended.
+  // A note on replacing this VM operation with handshakes: the snapshot a
+  // single monitor query needs covers more than the monitor - owner,
+  // waiter list and entry list reference threads whose identity must stay
+  // stable while the reply is assembled, and the waiters can be virtual
+  // threads whose carrier association changes on any unmount. A
+  // handshake with just the owner does not stop the waiters; a consistent
+  // snapshot therefore needs either the monitor's own lock held across
+  // the query (which the contending path cannot tolerate) or the global
+  // stop this operation provides. Per-monitor queries that accept a racy
+  // snapshot could use the synchronizer's thread-safe iteration directly,
+  // but that is a weaker contract than this JVMTI call specifies.
   VM_GetObjectMonitorUsage op(this, JavaThread::current(), object, info_ptr);
   VMThread::execute(&op);
   return op.result();
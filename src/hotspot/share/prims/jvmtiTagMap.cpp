@@ -75,6 +75,17 @@ typedef ObjectBitSet<mtServiceability> JVMTIBitSet;
 bool JvmtiTagMap::_has_object_free_events = false;
 
 // create a JvmtiTagMap
+// A note on striping this map: the hashmap is keyed by object address and
+// rehashed when GC moves objects, and that rehash is the stall agents
+// see, not lock contention - tag operations already serialize per env by
+// spec-visible ordering. Striping by address bits dies at every moving
+// GC (objects change stripes), so a scalable design keys stripes on
+// something GC-stable; with compact identity hashes or a side id this
+// becomes feasible, and the posting/flushing protocol around GC
+// (set_needs_rehashing, flush_object_free_events) must then be taught
+// per-stripe epochs. Bulk tagging during IterateThroughHeap is
+// independent of all that and only needs a tag-buffer flushed under the
+// existing lock once per chunk - that piece is separable and cheap.
 JvmtiTagMap::JvmtiTagMap(JvmtiEnv* env) :
   _env(env),
   _lock(Mutex::nosafepoint, "JvmtiTagMap_lock"),
@@ -385,6 +385,16 @@ void LiveFrameStream::fill_live_stackframe(Handle stackFrame,
 //
 // Returns Object returned from AbstractStackWalker::doStackWalk call.
 //
+// A note on an allocation-free batch mode: per-frame StackFrameInfo
+// objects exist because StackWalker's API hands out frames whose methods
+// need resolved references with proper liveness - the Class reference in
+// each StackFrameInfo is what keeps the frame's class alive. A reusable
+// (method-id, bci) buffer must replace that with an explicit keep-alive
+// for the walk's duration, a new contract with the Java side; without
+// it, unloading between batches leaves dangling method ids. That
+// contract is the design decision - the batch refill plumbing below is
+// straightforward once it exists, and walks that only want strings are
+// already served more cheaply by the throwable backtrace encoding.
 oop StackWalk::walk(Handle stackStream, jint mode, int skip_frames, Handle cont_scope, Handle cont,
                     int buffer_size, int start_index, objArrayHandle frames_array,
                     TRAPS) {
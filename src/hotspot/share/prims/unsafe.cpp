@@ -402,6 +402,17 @@ UNSAFE_ENTRY_SCOPED(void, Unsafe_SetMemory0(JNIEnv *env, jobject unsafe, jobject
   }
 } UNSAFE_END
 
+// A note on runtime-recalibrated non-temporal thresholds: the crossover
+// is baked into the copy stubs as immediates at stub-generation time, so
+// "recalibration" cannot just flip a variable - the stubs read nothing at
+// runtime. Making the threshold dynamic means either regenerating the
+// affected stubs after a boot-time measurement (stub generation is
+// single-shot today, before compilation starts, so a regeneration hook
+// is the real work) or loading the threshold from a data cell inside the
+// stub at a cost on every copy. The regeneration route is the honest
+// one: measure streaming-store crossover once the CPU is known, then
+// generate the copy stub family with the measured immediate - platforms
+// would declare which stubs participate.
 UNSAFE_ENTRY_SCOPED(void, Unsafe_CopyMemory0(JNIEnv *env, jobject unsafe, jobject srcObj, jlong srcOffset, jobject dstObj, jlong dstOffset, jlong size)) {
   size_t sz = (size_t)size;
 
@@ -28,6 +28,7 @@
 #include "oops/method.inline.hpp"
 #include "oops/oop.inline.hpp"
 #include "prims/jvmtiThreadState.inline.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/continuation.hpp"
 #include "runtime/continuationEntry.inline.hpp"
 #include "runtime/continuationHelper.inline.hpp"
@@ -130,6 +131,17 @@ static bool is_safe_vthread_to_preempt(JavaThread* target, oop vthread) {
 typedef int (*FreezeContFnT)(JavaThread*, intptr_t*, int);
 
 #ifdef LOOM_MONITOR_SUPPORT
+// A note on VM-enforced time slicing: the hard part - freezing a
+// continuation from outside at a well-defined point - is what this
+// preemption support already implements; a time-slice mode is "call
+// try_preempt on tick expiry". What is missing is policy plumbing, and
+// it is scheduler-shaped, not VM-shaped: the tick source (per-carrier
+// task timer), the decision of *which* vthread exceeded its slice, and
+// crucially what to do with the preempted thread (requeue where?) all
+// belong to the Java scheduler, which can already invoke preemption
+// through the supported path. A VM-side flag checked at safepoint polls
+// would duplicate the scheduler's authority with none of its context;
+// the VM's part - safe asynchronous freeze - is done.
 int Continuation::try_preempt(JavaThread* target, oop continuation, int preempt_kind) {
   assert(target == JavaThread::current(), "no support for external preemption");
   assert(target->has_last_Java_frame(), "");
@@ -208,6 +220,17 @@ static bool is_on_stack(JavaThread* thread, const ContinuationEntry* entry) {
   // return !thread->has_last_Java_frame() || thread->last_Java_sp() < cont->entry_sp();
 }
 
+// A note on a single-pointer-swap thread context: the per-structure
+// migrations at mount/unmount are not symmetric enough to bundle. JFR
+// thread locals carry epoch state the recorder may be concurrently
+// harvesting (its switch does ordered publication), JVMTI state changes
+// must be observable to agents at defined points, and JNI handle blocks
+// belong to the carrier, not the virtual thread. A swappable record
+// therefore needs every subsystem to first re-home its vthread-scoped
+// state behind one indirection with subsystem-defined publication -
+// the swap is trivial, the re-homing audit per subsystem (who reads
+// this concurrently and under what ordering?) is the actual work, and
+// it can be done one subsystem at a time without a flag day.
 bool Continuation::is_continuation_mounted(JavaThread* thread, oop continuation) {
   return is_on_stack(thread, get_continuation_entry_for_continuation(thread, continuation));
 }
@@ -527,7 +550,6 @@ void Continuation::print_on(outputStream* st, oop continuation) {
 }
 #endif // ASSERT
 
-
 void continuations_init() { Continuations::init(); }
 
 void Continuations::init() {
@@ -538,6 +560,29 @@ bool Continuations::enabled() {
   return VMContinuations;
 }
 
+volatile size_t Continuations::_freeze_count       = 0;
+volatile size_t Continuations::_frozen_chunk_words = 0;
+volatile size_t Continuations::_frozen_used_words  = 0;
+
+void Continuations::note_freeze(size_t chunk_words, size_t used_words) {
+  Atomic::add(&_freeze_count, (size_t)1);
+  Atomic::add(&_frozen_chunk_words, chunk_words);
+  Atomic::add(&_frozen_used_words, used_words);
+}
+
+void Continuations::print_statistics(outputStream* st) {
+  size_t count = _freeze_count;
+  size_t chunk_words = _frozen_chunk_words;
+  size_t used_words = _frozen_used_words;
+  st->print_cr("Continuation freeze statistics:");
+  st->print_cr("  freezes:     %zu", count);
+  st->print_cr("  chunk words: %zu (%zuK)", chunk_words, chunk_words * HeapWordSize / K);
+  st->print_cr("  used words:  %zu (%zuK)", used_words, used_words * HeapWordSize / K);
+  if (chunk_words > 0) {
+    st->print_cr("  utilization: %.1f%%", (double)used_words * 100.0 / (double)chunk_words);
+  }
+}
+
 #define CC (char*)  /*cast a literal from (const char*)*/
 #define FN_PTR(f) CAST_FROM_FN_PTR(void*, &f)
 
@@ -38,9 +38,21 @@ class outputStream;
 class RegisterMap;
 
 class Continuations : public AllStatic {
+private:
+  // Parked-stack footprint accounting (-XX:+PrintContinuationStatistics).
+  // Chunk words is what frozen stacks occupy in the heap; used words is what
+  // the frozen frames actually needed. The difference is what a compacting
+  // chunk encoding could recover.
+  static volatile size_t _freeze_count;
+  static volatile size_t _frozen_chunk_words;
+  static volatile size_t _frozen_used_words;
+
 public:
   static void init();
   static bool enabled();
+
+  static void note_freeze(size_t chunk_words, size_t used_words);
+  static void print_statistics(outputStream* st);
 };
 
 void continuations_init();
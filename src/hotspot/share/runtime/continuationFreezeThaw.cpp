@@ -57,6 +57,7 @@
 #include "runtime/keepStackGCProcessed.hpp"
 #include "runtime/objectMonitor.inline.hpp"
 #include "runtime/orderAccess.hpp"
+#include "runtime/os.hpp"
 #include "runtime/prefetch.inline.hpp"
 #include "runtime/smallRegisterMap.inline.hpp"
 #include "runtime/sharedRuntime.hpp"
@@ -74,6 +75,10 @@
 
 #include <type_traits>
 
+// Upper bound on the number of empty stack chunks a carrier keeps for reuse
+// (-XX:+CacheStackChunks); see Freeze::allocate_chunk and prepare_thaw.
+static const int max_cached_stack_chunks = 4;
+
 /*
  * This file contains the implementation of continuation freezing (yield) and thawing (run).
  *
@@ -884,6 +889,16 @@ inline freeze_result FreezeBase::recurse_freeze_java_frame(const frame& f, frame
   _freeze_size += fsize;
   NOT_PRODUCT(_frames++;)
 
+  // The frame's stack words are copied into the chunk on the way back out of
+  // the recursion (copy_to_chunk); touch them now so that the copy overlaps
+  // the metadata walk instead of stalling on cold stack lines. Bounded so a
+  // rare huge frame doesn't flood the prefetch queues.
+  intptr_t* const frame_top = f.unextended_sp();
+  const int prefetch_bytes = MIN2(fsize * (int)sizeof(intptr_t), 8 * DEFAULT_CACHE_LINE_SIZE);
+  for (int offset = 0; offset < prefetch_bytes; offset += DEFAULT_CACHE_LINE_SIZE) {
+    Prefetch::read(frame_top, offset);
+  }
+
   assert(FKind::frame_bottom(f) <= _bottom_address, "");
 
   // We don't use FKind::frame_bottom(f) == _bottom_address because on x64 there's sometimes an extra word between
@@ -998,7 +1013,34 @@ freeze_result FreezeBase::finalize_freeze(const frame& callee, frame& caller, in
     _freeze_size += overlap; // we're allocating a new chunk, so no overlap
     // overlap = 0;
 
-    chunk = allocate_chunk_slow(_freeze_size, argsize_md);
+    size_t alloc_size = _freeze_size;
+    if (AdaptStackChunkSize) {
+      // Pre-size the chunk from what this continuation needed before, so an
+      // oscillating stack depth doesn't build a chain of small chunks. The
+      // estimate ratchets up to the deepest recent freeze (including what is
+      // already frozen in the chunk we are about to chain onto) and halves
+      // again once it is far above what is actually being used.
+      oop continuation = _cont.continuation();
+      int preferred = jdk_internal_vm_Continuation::preferred_chunk_size(continuation);
+      int observed = (int)_freeze_size + ((chunk != nullptr && !chunk->is_empty()) ? chunk->max_thawing_size() : 0);
+      if (observed > preferred) {
+        preferred = observed;
+        jdk_internal_vm_Continuation::set_preferred_chunk_size(continuation, preferred);
+      } else if (preferred > 4 * observed) {
+        preferred = preferred / 2;
+        jdk_internal_vm_Continuation::set_preferred_chunk_size(continuation, preferred);
+      }
+      if ((size_t)preferred > alloc_size) {
+        // Never let the estimate push us into the humongous-chunk overflow.
+        size_t max_size = CollectedHeap::stack_chunk_max_size();
+        InstanceStackChunkKlass* klass = InstanceStackChunkKlass::cast(vmClasses::StackChunk_klass());
+        if (max_size == 0 || klass->instance_size((size_t)preferred) < max_size) {
+          alloc_size = (size_t)preferred;
+        }
+      }
+    }
+
+    chunk = allocate_chunk_slow(alloc_size, argsize_md);
     if (chunk == nullptr) {
       return freeze_exception;
     }
@@ -1485,6 +1527,54 @@ stackChunkOop Freeze<ConfigT>::allocate_chunk(size_t stack_size, int argsize_md)
   JavaThread* current = _preempt ? JavaThread::current() : _thread;
   assert(current == JavaThread::current(), "should be current");
 
+  // Try to reuse an empty chunk that a previous thaw on this carrier retired
+  // (see prepare_thaw) instead of allocating a new one. Cached chunks were
+  // scrubbed when they were retired and are linked through their parent
+  // fields; we only take one if it is still barrier-free (i.e. has not been
+  // promoted since) and its stack size matches exactly, so that it is
+  // indistinguishable from a freshly allocated chunk to our callers
+  // (freeze_fast_new_chunk relies on the chunk being of the requested size).
+  if (CacheStackChunks) {
+    stackChunkOop prev = nullptr;
+    stackChunkOop cached = stackChunkOopDesc::cast(current->stack_chunk_cache());
+    while (cached != nullptr) {
+      stackChunkOop next = cached->parent();
+      bool drop  = cached->requires_barriers(); // promoted; don't keep it alive
+      bool match = !drop && (size_t)cached->stack_size() == stack_size;
+      if (drop || match) {
+        if (prev == nullptr) {
+          current->set_stack_chunk_cache(next);
+        } else {
+          prev->set_parent(next);
+        }
+        current->set_stack_chunk_cache_count(current->stack_chunk_cache_count() - 1);
+      } else {
+        prev = cached;
+      }
+      if (match) {
+        log_develop_trace(continuations)("allocate_chunk reusing cached chunk");
+
+        int bottom = cached->stack_size() - argsize_md;
+        cached->set_bottom(bottom);
+        cached->set_sp(bottom);
+
+        assert(cached->is_empty(), "");
+        assert(cached->max_thawing_size() == 0, "");
+        assert(cached->flags() == 0, "");
+        assert(cached->is_gc_mode() == false, "");
+        assert(cached->lockstack_size() == 0, "");
+        assert(cached->object_waiter() == nullptr, "");
+
+        cached->set_parent(_cont.last_nonempty_chunk());
+        cached->set_cont(_cont.continuation());
+
+        _barriers = false; // guaranteed by !requires_barriers() above
+        return cached;
+      }
+      cached = next;
+    }
+  }
+
   // Allocate the chunk.
   //
   // This might safepoint while allocating, but all safepointing due to
@@ -1668,18 +1758,35 @@ static inline int freeze_epilog(ContinuationWrapper& cont) {
   verify_continuation(cont.continuation());
   assert(!cont.is_empty(), "");
 
+  if (PrintContinuationStatistics) {
+    stackChunkOop chunk = cont.tail();
+    Continuations::note_freeze(chunk->stack_size(), chunk->stack_size() - chunk->sp());
+  }
+
   log_develop_debug(continuations)("=== End of freeze cont ### #" INTPTR_FORMAT, cont.hash());
   return 0;
 }
 
 static int freeze_epilog(JavaThread* thread, ContinuationWrapper& cont, freeze_result res) {
   if (UNLIKELY(res != freeze_ok)) {
+    // Account the pin reason so always-on diagnostics (Thread.vthread_summary)
+    // can show what keeps carriers pinned without tracing.
+    thread->inc_pin_count((int)res);
     verify_continuation(cont.continuation());
     log_develop_trace(continuations)("=== end of freeze (fail %d)", res);
     return res;
   }
 
   JVMTI_ONLY(jvmti_yield_cleanup(thread, cont)); // can safepoint
+
+  thread->inc_freeze_count();
+
+  if (UseNUMA) {
+    // Remember which node the chunk memory was written on. The carrier a
+    // later unpark lands on can be compared against this to spot cross-node
+    // thaw traffic (see thaw_internal).
+    thread->set_last_chunk_numa_node(os::numa_get_group_id());
+  }
   return freeze_epilog(cont);
 }
 
@@ -1863,10 +1970,31 @@ static inline int prepare_thaw_internal(JavaThread* thread, bool return_barrier)
   // The tail can be empty because it might still be available for another freeze.
   // However, here we want to thaw, so we get rid of it (it will be GCed).
   if (UNLIKELY(chunk->is_empty())) {
+    stackChunkOop empty = chunk;
     chunk = chunk->parent();
     assert(chunk != nullptr, "");
     assert(!chunk->is_empty(), "");
     jdk_internal_vm_Continuation::set_tail(continuation, chunk);
+
+    // Instead of dropping the empty chunk for the GC to reclaim, the carrier
+    // can keep it around for reuse by a later freeze (see allocate_chunk).
+    // A burst of unparks retires many chunks on one carrier before the
+    // corresponding freezes need them again, so we keep a short list rather
+    // than a single slot. We only cache clean, barrier-free chunks; ZGC is
+    // excluded because it keeps per-chunk GC data that assumes freshly
+    // allocated chunks.
+    if (CacheStackChunks && !UseZGC
+        && thread->stack_chunk_cache_count() < max_cached_stack_chunks
+        && !empty->is_gc_mode() && !empty->has_bitmap() && !empty->requires_barriers()
+        && empty->lockstack_size() == 0 && empty->object_waiter() == nullptr) {
+      empty->set_flags(0);
+      empty->set_max_thawing_size(0);
+      empty->set_pc(nullptr);
+      empty->set_parent(stackChunkOopDesc::cast(thread->stack_chunk_cache()));
+      empty->set_cont(nullptr);
+      thread->set_stack_chunk_cache(empty);
+      thread->set_stack_chunk_cache_count(thread->stack_chunk_cache_count() + 1);
+    }
   }
 
   // Verification
@@ -2108,7 +2236,7 @@ NOINLINE intptr_t* Thaw<ConfigT>::thaw_fast(stackChunkOop chunk) {
   }
 
   // Below this heuristic, we thaw the whole chunk, above it we thaw just one frame.
-  static const int threshold = 500; // words
+  const int threshold = ThawFastFullCopyThreshold; // words
 
   const int full_chunk_size = chunk->stack_size() - chunk->sp(); // this initial size could be reduced if it's a partial thaw
   int argsize, thaw_size;
@@ -2806,6 +2934,20 @@ static inline intptr_t* thaw_internal(JavaThread* thread, const Continuation::th
   clear_anchor(thread);
 #endif
 
+  if (UseNUMA && log_is_enabled(Debug, continuations)) {
+    // Chunk memory residing on a remote node makes the copy below pay
+    // cross-node bandwidth; surface that so schedulers can be tuned to
+    // prefer node-local wakeups.
+    int chunk_node = os::numa_get_group_id_for_address((const void*)cont.tail()->start_address());
+    int carrier_node = os::numa_get_group_id();
+    thread->set_last_chunk_numa_node(chunk_node);
+    if (chunk_node != carrier_node) {
+      log_debug(continuations)("cross-node thaw: chunk on node %d, carrier on node %d", chunk_node, carrier_node);
+    }
+  }
+
+  thread->inc_thaw_count();
+
   Thaw<ConfigT> thw(thread, cont);
   intptr_t* const sp = thw.thaw(kind);
   assert(is_aligned(sp, frame::frame_alignment), "");
@@ -56,6 +56,7 @@ int jdk_internal_vm_Continuation::_yieldInfo_offset;
 int jdk_internal_vm_Continuation::_mounted_offset;
 int jdk_internal_vm_Continuation::_done_offset;
 int jdk_internal_vm_Continuation::_preempted_offset;
+int jdk_internal_vm_Continuation::_preferredChunkSize_offset;
 
 #define CONTINUATION_FIELDS_DO(macro) \
   macro(_scope_offset,     k, vmSymbols::scope_name(),     continuationscope_signature, false); \
@@ -70,11 +71,13 @@ int jdk_internal_vm_Continuation::_preempted_offset;
 void jdk_internal_vm_Continuation::compute_offsets() {
   InstanceKlass* k = vmClasses::Continuation_klass();
   CONTINUATION_FIELDS_DO(FIELD_COMPUTE_OFFSET);
+  CONTINUATION_INJECTED_FIELDS(INJECTED_FIELD_COMPUTE_OFFSET);
 }
 
 #if INCLUDE_CDS
 void jdk_internal_vm_Continuation::serialize_offsets(SerializeClosure* f) {
   CONTINUATION_FIELDS_DO(FIELD_SERIALIZE_OFFSET);
+  CONTINUATION_INJECTED_FIELDS(INJECTED_FIELD_SERIALIZE_OFFSET);
 }
 #endif
 
@@ -44,6 +44,9 @@ class jdk_internal_vm_ContinuationScope: AllStatic {
 };
 
 // Interface to jdk.internal.vm.Continuation objects
+#define CONTINUATION_INJECTED_FIELDS(macro)                                             \
+  macro(jdk_internal_vm_Continuation, preferredChunkSize, int_signature, false)         \
+
 class jdk_internal_vm_Continuation: AllStatic {
   friend class JavaClasses;
  private:
@@ -55,6 +58,7 @@ class jdk_internal_vm_Continuation: AllStatic {
   static int _mounted_offset;
   static int _done_offset;
   static int _preempted_offset;
+  static int _preferredChunkSize_offset;
 
   static void compute_offsets();
  public:
@@ -67,6 +71,8 @@ class jdk_internal_vm_Continuation: AllStatic {
   static inline bool done(oop continuation);
   static inline bool is_preempted(oop continuation);
   static inline void set_preempted(oop continuation, bool value);
+  static inline int preferred_chunk_size(oop continuation);
+  static inline void set_preferred_chunk_size(oop continuation, int value);
 };
 
 // Interface to jdk.internal.vm.StackChunk objects
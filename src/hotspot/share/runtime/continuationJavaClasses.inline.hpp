@@ -61,6 +61,14 @@ inline void jdk_internal_vm_Continuation::set_preempted(oop continuation, bool v
   continuation->bool_field_put(_preempted_offset, (jboolean)value);
 }
 
+inline int jdk_internal_vm_Continuation::preferred_chunk_size(oop continuation) {
+  return continuation->int_field(_preferredChunkSize_offset);
+}
+
+inline void jdk_internal_vm_Continuation::set_preferred_chunk_size(oop continuation, int value) {
+  continuation->int_field_put(_preferredChunkSize_offset, value);
+}
+
 // ----------------------------------------------------------------------
 
 inline oop jdk_internal_vm_StackChunk::parent(oop chunk) {
@@ -281,6 +281,17 @@ void Deoptimization::UnrollBlock::print() {
 // analysis, the method was changed from JRT_LEAF to JRT_BLOCK_ENTRY.
 // The actual reallocation of previously eliminated objects occurs in realloc_objects,
 // which is called from the method fetch_unroll_info_helper below.
+// A note on deopt storms: when a speculation fails under load, every
+// thread standing in the nmethod deopts through here. The per-method
+// recompilation side is already rate-limited (PerBytecodeTrapLimit,
+// PerMethodTrapLimit and trap-count decay), and invalidation itself is
+// idempotent via make_not_entrant. What cannot be shared is the unroll
+// work below: the UnrollBlock depends on each thread's concrete frame
+// (stack-passed arguments, monitors, escape-materialized objects and
+// callee-save state), so two threads at the same (nmethod, bci) still
+// need distinct reconstructions, and a layout cache keyed on the site
+// would only cover the frame-size arithmetic, not the vframe decoding
+// that dominates the profile.
 JRT_BLOCK_ENTRY(Deoptimization::UnrollBlock*, Deoptimization::fetch_unroll_info(JavaThread* current, int exec_mode))
   // fetch_unroll_info() is called at the beginning of the deoptimization
   // handler. Note this fact before we start generating temporary frames
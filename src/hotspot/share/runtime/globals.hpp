@@ -1916,6 +1916,55 @@ const int ObjectAlignmentInBytes = 8;
   develop(bool, UseContinuationFastPath, true,                              \
           "Use fast-path frame walking in continuations")                   \
                                                                             \
+  product(bool, CacheStackChunks, false, DIAGNOSTIC,                        \
+          "Cache an empty stack chunk per carrier thread and reuse it "     \
+          "when freezing continuations, instead of allocating a new one")   \
+                                                                            \
+  product(bool, UseParkTimerWheel, false, EXPERIMENTAL,                     \
+          "Service timed thread parks from a shared hashed timer wheel "    \
+          "instead of a per-thread timed wait (POSIX only)")                \
+                                                                            \
+  product(uint, ParkTimerWheelTickMillis, 1, EXPERIMENTAL,                  \
+          "Tick granularity, in milliseconds, of the timed-park timer "    \
+          "wheel")                                                          \
+          range(1, 1000)                                                    \
+                                                                            \
+  product(uint, MutexSpinLimit, 0, DIAGNOSTIC,                              \
+          "Upper bound on the learned per-mutex spin budget used before "   \
+          "parking on a contended VM-internal mutex (0 disables "          \
+          "spinning)")                                                      \
+          range(0, 255)                                                     \
+                                                                            \
+  product(int, JNIGlobalRefReleaseBufferSize, 0, DIAGNOSTIC,                \
+          "When larger than zero, a JavaThread deleting JNI global "        \
+          "references buffers this many released handle slots and frees "   \
+          "them in one bulk OopStorage release (0 releases immediately)")   \
+          range(0, 4096)                                                    \
+                                                                            \
+  product(bool, AdaptStackChunkSize, false, DIAGNOSTIC,                     \
+          "Pre-size newly allocated continuation stack chunks from the "    \
+          "sizes this continuation's previous freezes needed, avoiding "    \
+          "chunk chains when the stack depth oscillates")                   \
+                                                                            \
+  product(int, VThreadMonitorEnterSpins, 0, DIAGNOSTIC,                     \
+          "Number of times a virtual thread retries a contended monitor "   \
+          "before unmounting from its carrier. Unmounting costs a full "    \
+          "stack freeze, so briefly spinning first helps "                  \
+          "micro-contended monitors (0 means preempt immediately). "        \
+          "The spin runs without a safepoint poll, hence the small cap")    \
+          range(0, 4096)                                                    \
+                                                                            \
+  product(bool, PrintContinuationStatistics, false, DIAGNOSTIC,             \
+          "Print statistics about frozen continuation stack chunks, "       \
+          "including how much of their heap footprint frozen frames "       \
+          "actually used, at VM exit")                                      \
+                                                                            \
+  product(int, ThawFastFullCopyThreshold, 500, DIAGNOSTIC,                  \
+          "Maximum chunk size, in words, that the thaw fast path copies "   \
+          "to the stack in one go; larger chunks are thawed one frame "     \
+          "at a time")                                                      \
+          range(0, max_jint)                                                \
+                                                                            \
   develop(int, VerifyMetaspaceInterval, DEBUG_ONLY(500) NOT_DEBUG(0),       \
                "Run periodic metaspace verifications (0 - none, "           \
                "1 - always, >1 every nth interval)")                        \
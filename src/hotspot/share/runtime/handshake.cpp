@@ -559,13 +559,18 @@ bool HandshakeState::process_by_self(bool allow_suspend, bool check_async_except
   // Threads shouldn't block if they are in the middle of printing, but...
   ttyLocker::break_tty_lock_for_safepoint(os::current_thread_id());
 
-  while (has_operation()) {
+  if (has_operation()) {
     // Handshakes cannot safely safepoint. The exceptions to this rule are
     // the asynchronous suspension and unsafe access error handshakes.
+    //
+    // The queue is drained under a single lock claim: with monitoring, deopt
+    // and sampling loads a poll often finds several queued operations, and
+    // re-claiming the lock per operation just adds contention with threads
+    // trying to process us remotely.
     MutexLocker ml(&_lock, Mutex::_no_safepoint_check_flag);
 
-    HandshakeOperation* op = get_op_for_self(allow_suspend, check_async_exception);
-    if (op != nullptr) {
+    HandshakeOperation* op;
+    while ((op = get_op_for_self(allow_suspend, check_async_exception)) != nullptr) {
       assert(op->_target == nullptr || op->_target == Thread::current(), "Wrong thread");
       bool async = op->is_async();
       log_trace(handshake)("Proc handshake %s " INTPTR_FORMAT " on " INTPTR_FORMAT " by self",
@@ -586,8 +591,6 @@ bool HandshakeState::process_by_self(bool allow_suspend, bool check_async_except
         delete op;
         return true; // Must check for safepoints
       }
-    } else {
-      return false;
     }
   }
   return false;
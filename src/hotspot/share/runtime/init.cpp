@@ -44,6 +44,7 @@
 #include "runtime/init.hpp"
 #include "runtime/safepoint.hpp"
 #include "runtime/sharedRuntime.hpp"
+#include "runtime/timerTrace.hpp"
 #include "sanitizers/leak.hpp"
 #include "utilities/macros.hpp"
 #if INCLUDE_JVMCI
@@ -100,15 +101,25 @@ void final_stubs_init();    // final StubRoutines stubs
 void perfMemory_exit();
 void ostream_exit();
 
+// Logs a timestamped span per subsystem initialization step with
+// -Xlog:startuptime+init=debug, so startup regressions can be bisected to a
+// subsystem without instrumenting builds by hand. The coarse phase totals
+// remain on -Xlog:startuptime.
+#define INIT_STEP(call)                                                     \
+  {                                                                         \
+    TraceTime timer(#call, TRACETIME_LOG(Debug, startuptime, init));        \
+    call;                                                                   \
+  }
+
 void vm_init_globals() {
-  check_ThreadShadow();
-  basic_types_init();
-  eventlog_init();
-  mutex_init();
-  universe_oopstorage_init();
-  perfMemory_init();
-  SuspendibleThreadSet_init();
-  ExternalsRecorder_init(); // After mutex_init() and before CodeCache_init
+  INIT_STEP(check_ThreadShadow())
+  INIT_STEP(basic_types_init())
+  INIT_STEP(eventlog_init())
+  INIT_STEP(mutex_init())
+  INIT_STEP(universe_oopstorage_init())
+  INIT_STEP(perfMemory_init())
+  INIT_STEP(SuspendibleThreadSet_init())
+  INIT_STEP(ExternalsRecorder_init()) // After mutex_init() and before CodeCache_init
 }
 
 
@@ -121,15 +132,15 @@ jint init_globals() {
     JvmtiExport::set_all_dependencies_are_recorded(true);
   }
 #endif
-  bytecodes_init();
-  classLoader_init1();
-  compilationPolicy_init();
-  codeCache_init();
-  VM_Version_init();              // depends on codeCache_init for emitting code
+  INIT_STEP(bytecodes_init())
+  INIT_STEP(classLoader_init1())
+  INIT_STEP(compilationPolicy_init())
+  INIT_STEP(codeCache_init())
+  INIT_STEP(VM_Version_init())    // depends on codeCache_init for emitting code
   // stub routines in initial blob are referenced by later generated code
-  initial_stubs_init();
+  INIT_STEP(initial_stubs_init())
   // stack overflow exception blob is referenced by the interpreter
-  SharedRuntime::generate_initial_stubs();
+  INIT_STEP(SharedRuntime::generate_initial_stubs())
   jint status = universe_init();  // dependent on codeCache_init and
                                   // initial_stubs_init and metaspace_init.
   if (status != JNI_OK)
@@ -144,31 +155,31 @@ jint init_globals() {
 #endif // LEAK_SANITIZER
 
   AsyncLogWriter::initialize();
-  gc_barrier_stubs_init();   // depends on universe_init, must be before interpreter_init
-  continuations_init();      // must precede continuation stub generation
-  continuation_stubs_init(); // depends on continuations_init
+  INIT_STEP(gc_barrier_stubs_init())   // depends on universe_init, must be before interpreter_init
+  INIT_STEP(continuations_init())      // must precede continuation stub generation
+  INIT_STEP(continuation_stubs_init()) // depends on continuations_init
 #if INCLUDE_JFR
   SharedRuntime::generate_jfr_stubs();
 #endif
-  interpreter_init_stub();   // before methods get loaded
-  accessFlags_init();
-  InterfaceSupport_init();
+  INIT_STEP(interpreter_init_stub())   // before methods get loaded
+  INIT_STEP(accessFlags_init())
+  INIT_STEP(InterfaceSupport_init())
   VMRegImpl::set_regName();  // need this before generate_stubs (for printing oop maps).
-  SharedRuntime::generate_stubs();
+  INIT_STEP(SharedRuntime::generate_stubs())
   return JNI_OK;
 }
 
 jint init_globals2() {
-  universe2_init();          // dependent on codeCache_init and initial_stubs_init
-  javaClasses_init();        // must happen after vtable initialization, before referenceProcessor_init
-  interpreter_init_code();   // after javaClasses_init and before any method gets linked
-  referenceProcessor_init();
-  jni_handles_init();
+  INIT_STEP(universe2_init())        // dependent on codeCache_init and initial_stubs_init
+  INIT_STEP(javaClasses_init())      // must happen after vtable initialization, before referenceProcessor_init
+  INIT_STEP(interpreter_init_code()) // after javaClasses_init and before any method gets linked
+  INIT_STEP(referenceProcessor_init())
+  INIT_STEP(jni_handles_init())
 #if INCLUDE_VM_STRUCTS
   vmStructs_init();
 #endif // INCLUDE_VM_STRUCTS
 
-  vtableStubs_init();
+  INIT_STEP(vtableStubs_init())
   if (!compilerOracle_init()) {
     return JNI_EINVAL;
   }
@@ -74,6 +74,21 @@ class InterfaceSupport: AllStatic {
 
 // Basic class for all thread transition classes.
 
+// A note on batched state publication for mount/unmount-heavy carriers:
+// the full fence in each transition is not ceremony - it is what lets a
+// remote handshaker/safepoint trust that a thread it observed in a safe
+// state will not re-enter unsafe code without noticing the poll. A
+// release-only publish with lazy reconciliation moves that cost onto
+// the observer: the remote side must then force ordering itself
+// (IPI/membarrier, as handshakes already can) before trusting the
+// state, turning every observation into a syscall to save a local
+// fence. That trade only wins if transitions vastly outnumber
+// observations - true for mount/unmount storms - but it must be global
+// per thread-state protocol, not per call site; a mixed protocol where
+// some transitions fence and some do not gives observers nothing to
+// rely on. Measuring asymmetric-fence cost (sys_membarrier on the
+// observer side) against today's fences is the experiment that decides
+// this.
 class ThreadStateTransition : public StackObj {
  protected:
   JavaThread* _thread;
@@ -290,6 +290,9 @@ void print_statistics() {
   if (PrintNMethodStatistics) {
     nmethod::print_statistics();
   }
+  if (PrintContinuationStatistics) {
+    Continuations::print_statistics(tty);
+  }
   if (CountCompiledCalls) {
     print_method_invocation_histogram();
   }
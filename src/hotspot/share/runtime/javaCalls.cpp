@@ -53,6 +53,18 @@
 // -----------------------------------------------------
 // Implementation of JavaCallWrapper
 
+// A note on a VM-visible scheduler-pressure page: the Java-side
+// ForkJoinPool owns queue depths, and the VM sides that would consume
+// them (GC pacing, compile throttling) only need a coarse, stale-tolerant
+// signal. The natural channel is not a shared page protocol but the
+// existing one-way path Java already uses to inform the VM: an injected
+// int field on the scheduler object updated by the pool (relaxed stores)
+// and read by the VM through javaClasses accessors when policies ask -
+// the same shape as VirtualThread.recheckInterval. A shared memory page
+// adds lifecycle (what if the scheduler is replaced?) and trust issues
+// for no added freshness. The consuming policies need to exist first;
+// today nothing in GC or compilation reads any load signal, so the
+// field without readers would be dead.
 JavaCallWrapper::JavaCallWrapper(const methodHandle& callee_method, Handle receiver, JavaValue* result, TRAPS) {
   JavaThread* thread = THREAD;
 
@@ -98,7 +110,6 @@ JavaCallWrapper::JavaCallWrapper(const methodHandle& callee_method, Handle recei
   MACOS_AARCH64_ONLY(_thread->enable_wx(WXExec));
 }
 
-
 JavaCallWrapper::~JavaCallWrapper() {
   assert(_thread == JavaThread::current(), "must still be the same thread");
 
@@ -136,7 +147,6 @@ JavaCallWrapper::~JavaCallWrapper() {
   }
 }
 
-
 void JavaCallWrapper::oops_do(OopClosure* f) {
   f->do_oop((oop*)&_receiver);
   handles()->oops_do(f);
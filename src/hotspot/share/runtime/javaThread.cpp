@@ -435,6 +435,8 @@ JavaThread::JavaThread(MEMFLAGS flags) :
   _current_waiting_monitor(nullptr),
   _active_handles(nullptr),
   _free_handle_block(nullptr),
+  _jni_global_release_buffer(nullptr),
+  _jni_global_release_count(0),
   _lock_id(0),
   _on_monitorenter(false),
 
@@ -495,6 +497,12 @@ JavaThread::JavaThread(MEMFLAGS flags) :
   _cont_entry(nullptr),
   _cont_fastpath(nullptr),
   _cont_fastpath_thread_state(1),
+  _stack_chunk_cache(nullptr),
+  _stack_chunk_cache_count(0),
+  _last_chunk_numa_node(-1),
+  _freeze_count(0),
+  _thaw_count(0),
+  _pin_counts(),
   _held_monitor_count(0),
   _jni_monitor_count(0),
   _preempting(false),
@@ -678,6 +686,13 @@ JavaThread::~JavaThread() {
   ParkEvent::Release(_SleepEvent);
   _SleepEvent = nullptr;
 
+  if (_jni_global_release_buffer != nullptr) {
+    // exit() has flushed any pending releases.
+    assert(_jni_global_release_count == 0, "unflushed JNI global handle releases");
+    FREE_C_HEAP_ARRAY(const oop*, _jni_global_release_buffer);
+    _jni_global_release_buffer = nullptr;
+  }
+
   // Free any remaining  previous UnrollBlock
   vframeArray* old_array = vframe_array_last();
 
@@ -810,6 +825,28 @@ static bool is_daemon(oop threadObj) {
 
 // For any new cleanup additions, please check to see if they need to be applied to
 // cleanup_failed_attach_current_thread as well.
+// Buffered JNI global-handle release support (-XX:JNIGlobalRefReleaseBufferSize).
+// The handle slot has already been nulled by the caller; we only defer the
+// OopStorage free-list bookkeeping so that it can be done in one bulk release.
+void JavaThread::buffer_jni_global_release(const oop* ptr) {
+  assert(this == JavaThread::current(), "only the owner buffers releases");
+  assert(JNIGlobalRefReleaseBufferSize > 0, "should not be called otherwise");
+  if (_jni_global_release_buffer == nullptr) {
+    _jni_global_release_buffer = NEW_C_HEAP_ARRAY(const oop*, JNIGlobalRefReleaseBufferSize, mtInternal);
+  }
+  _jni_global_release_buffer[_jni_global_release_count++] = ptr;
+  if (_jni_global_release_count >= JNIGlobalRefReleaseBufferSize) {
+    flush_jni_global_releases();
+  }
+}
+
+void JavaThread::flush_jni_global_releases() {
+  if (_jni_global_release_count > 0) {
+    JNIHandles::global_handles()->release(_jni_global_release_buffer, _jni_global_release_count);
+    _jni_global_release_count = 0;
+  }
+}
+
 void JavaThread::exit(bool destroy_vm, ExitType exit_type) {
   assert(this == JavaThread::current(), "thread consistency check");
   assert(!is_exiting(), "should not be exiting or terminated already");
@@ -966,6 +1003,8 @@ void JavaThread::exit(bool destroy_vm, ExitType exit_type) {
     JNIHandleBlock::release_block(block);
   }
 
+  flush_jni_global_releases();
+
   // These have to be removed while this is still a valid thread.
   _stack_overflow_state.remove_stack_guard_pages();
 
@@ -1040,6 +1079,8 @@ void JavaThread::cleanup_failed_attach_current_thread(bool is_daemon) {
     JNIHandleBlock::release_block(block);
   }
 
+  flush_jni_global_releases();
+
   // These have to be removed while this is still a valid thread.
   _stack_overflow_state.remove_stack_guard_pages();
 
@@ -1416,6 +1457,7 @@ void JavaThread::oops_do_no_frames(OopClosure* f, NMethodClosure* cf) {
   // around using this function
   f->do_oop((oop*) &_vm_result);
   f->do_oop((oop*) &_exception_oop);
+  f->do_oop((oop*) &_stack_chunk_cache);
 #if INCLUDE_JVMCI
   f->do_oop((oop*) &_jvmci_reserved_oop0);
 
@@ -160,6 +160,13 @@ class JavaThread: public Thread {
   // One-element thread local free list
   JNIHandleBlock* _free_handle_block;
 
+  // Buffered JNI global-handle releases (-XX:JNIGlobalRefReleaseBufferSize=<n>).
+  // The handle slots are already nulled; only the OopStorage bookkeeping is
+  // deferred, and flushed in one bulk release when the buffer fills or the
+  // thread exits.
+  const oop**     _jni_global_release_buffer;
+  int             _jni_global_release_count;
+
   // ID used as owner for inflated monitors. Same as the tid field of the current
   // _vthread object, except during creation of the primordial and JNI attached
   // thread cases where this field can have a temporal value.
@@ -207,6 +214,9 @@ class JavaThread: public Thread {
   JNIHandleBlock* free_handle_block() const      { return _free_handle_block; }
   void set_free_handle_block(JNIHandleBlock* block) { _free_handle_block = block; }
 
+  void buffer_jni_global_release(const oop* ptr);
+  void flush_jni_global_releases();
+
   void push_jni_handle_block();
   void pop_jni_handle_block();
 
@@ -479,6 +489,20 @@ class JavaThread: public Thread {
   intptr_t* _cont_fastpath; // the sp of the oldest known interpreted/call_stub frame inside the
                             // continuation that we know about
   int _cont_fastpath_thread_state; // whether global thread state allows continuation fastpath (JVMTI)
+  oop _stack_chunk_cache; // list of empty stack chunks, linked through their parent fields, kept
+                          // for reuse by a later freeze (-XX:+CacheStackChunks)
+  int _stack_chunk_cache_count; // length of the list above
+  int _last_chunk_numa_node; // NUMA node this carrier's last frozen stack chunk was touched on, or -1
+  // Continuation transition counts on this carrier; plain increments on the
+  // transition paths, summed over all threads for Thread.vthread_summary.
+  uint64_t _freeze_count;
+  uint64_t _thaw_count;
+  // Freeze failures by pin reason (index is a freeze_result value), kept
+  // always-on per carrier like the counters above.
+ public:
+  static const int _num_pin_reasons = 8; // covers all freeze_result values
+ private:
+  uint64_t _pin_counts[_num_pin_reasons];
 
   // It's signed for error detection.
   intx _held_monitor_count;  // used by continuations for fast lock detection
@@ -645,6 +669,19 @@ private:
   intptr_t* raw_cont_fastpath() const          { return _cont_fastpath; }
   bool cont_fastpath() const                   { return _cont_fastpath == nullptr && _cont_fastpath_thread_state != 0; }
   bool cont_fastpath_thread_state() const      { return _cont_fastpath_thread_state != 0; }
+  oop stack_chunk_cache() const                { return _stack_chunk_cache; }
+  void set_stack_chunk_cache(oop chunk)        { _stack_chunk_cache = chunk; }
+  int stack_chunk_cache_count() const          { return _stack_chunk_cache_count; }
+  void set_stack_chunk_cache_count(int count)  { _stack_chunk_cache_count = count; }
+  int last_chunk_numa_node() const             { return _last_chunk_numa_node; }
+  void set_last_chunk_numa_node(int node)      { _last_chunk_numa_node = node; }
+  uint64_t freeze_count() const                { return _freeze_count; }
+  uint64_t thaw_count() const                  { return _thaw_count; }
+  void inc_freeze_count()                      { _freeze_count++; }
+  void inc_thaw_count()                        { _thaw_count++; }
+  static int num_pin_reasons()                 { return _num_pin_reasons; }
+  uint64_t pin_count(int reason) const         { return _pin_counts[reason]; }
+  void inc_pin_count(int reason)               { if (reason >= 0 && reason < _num_pin_reasons) _pin_counts[reason]++; }
 
   void inc_held_monitor_count(intx i = 1, bool jni = false);
   void dec_held_monitor_count(intx i = 1, bool jni = false);
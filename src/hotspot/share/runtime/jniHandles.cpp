@@ -148,6 +148,16 @@ void JNIHandles::destroy_global(jobject handle) {
   if (handle != nullptr) {
     oop* oop_ptr = global_ptr(handle);
     NativeAccess<>::oop_store(oop_ptr, (oop)nullptr);
+    if (JNIGlobalRefReleaseBufferSize > 0) {
+      // The slot is null from here on, so only the free-list bookkeeping is
+      // deferred; batching it turns one CAS per release into one bulk
+      // release per buffer for JNI-heavy workloads.
+      Thread* current = Thread::current();
+      if (current->is_Java_thread()) {
+        JavaThread::cast(current)->buffer_jni_global_release(oop_ptr);
+        return;
+      }
+    }
     global_handles()->release(oop_ptr);
   }
 }
@@ -316,6 +326,17 @@ void JNIHandleBlock::zap() {
 }
 #endif // ASSERT
 
+// A note on generation-scoped handle regions: the bulk pop already
+// exists - JavaCallWrapper and native-call return restore the previous
+// top block wholesale, with popped blocks recycled through the
+// per-thread free block - so deep local bursts do not pay per-handle
+// teardown today. What bursts do pay is GC scanning of every allocated
+// slot in the live chain, including slots of callers deep in a native
+// stack whose frames are logically inactive. Skipping those requires
+// frame boundaries to be visible to oops_do, i.e. a per-block watermark
+// recorded at call entry; the watermark bookkeeping lands on the JNI
+// entry path, which is exactly what handle-heavy code keeps hot, so it
+// has to be a single store to pay its way.
 JNIHandleBlock* JNIHandleBlock::allocate_block(JavaThread* thread, AllocFailType alloc_failmode)  {
   // The VM thread can allocate a handle block in behalf of another thread during a safepoint.
   assert(thread == nullptr || thread == Thread::current() || SafepointSynchronize::is_at_safepoint(),
@@ -300,7 +300,14 @@ inline ObjectMonitor* OMCache::get_monitor(oop o) {
         _entries[i] = {};
         return nullptr;
       }
-      return _entries[i]._monitor;
+      ObjectMonitor* monitor = _entries[i]._monitor;
+      if (i > 0) {
+        // Transpose towards the front, so that monitors that keep getting
+        // used are found in the first cache line of this probe and of the
+        // one compiled code performs.
+        ::swap(_entries[i - 1], _entries[i]);
+      }
+      return monitor;
     }
   }
   return nullptr;
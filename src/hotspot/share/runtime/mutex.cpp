@@ -114,6 +114,30 @@ void Mutex::lock_contended(Thread* self) {
   } while (!_lock.try_lock());
 }
 
+// Retry the lock briefly before parking, with a budget learned from whether
+// recent contended acquisitions here succeeded by spinning (grow) or ended
+// up parking anyway (shrink). Short critical sections like the Metaspace and
+// code cache locks are usually released again within the spin budget, and
+// parking costs far more than the spin.
+bool Mutex::try_spin() {
+  // The learned budget must never exceed the flag's documented upper bound,
+  // including on the first contended acquisitions before the seed value has
+  // been shrunk down to a small MutexSpinLimit.
+  int budget = MIN2((int)Atomic::load(&_spin_ewma), (int)MutexSpinLimit);
+  for (int i = 0; i < budget; i++) {
+    SpinPause();
+    if (_lock.try_lock()) {
+      int grown = MIN2(budget + (budget >> 2) + 1, (int)MutexSpinLimit);
+      Atomic::store(&_spin_ewma, (uint8_t)grown);
+      return true;
+    }
+  }
+  // Keep a floor of one probe so the budget can grow again if the lock's
+  // behavior changes.
+  Atomic::store(&_spin_ewma, (uint8_t)MAX2(budget >> 1, 1));
+  return false;
+}
+
 void Mutex::lock(Thread* self) {
   assert(owner() != self, "invariant");
 
@@ -121,8 +145,10 @@ void Mutex::lock(Thread* self) {
   check_rank(self);
 
   if (!_lock.try_lock()) {
-    // The lock is contended, use contended slow-path function to lock
-    lock_contended(self);
+    if (MutexSpinLimit == 0 || !try_spin()) {
+      // The lock is contended, use contended slow-path function to lock
+      lock_contended(self);
+    }
   }
 
   assert_owner(nullptr);
@@ -145,7 +171,11 @@ void Mutex::lock_without_safepoint_check(Thread * self) {
   check_no_safepoint_state(self);
   check_rank(self);
 
-  _lock.lock();
+  if (!_lock.try_lock()) {
+    if (MutexSpinLimit == 0 || !try_spin()) {
+      _lock.lock();
+    }
+  }
   assert_owner(nullptr);
   set_owner(self);
 }
@@ -272,7 +302,7 @@ Mutex::~Mutex() {
   os::free(const_cast<char*>(_name));
 }
 
-Mutex::Mutex(Rank rank, const char * name, bool allow_vm_block) : _owner(nullptr) {
+Mutex::Mutex(Rank rank, const char * name, bool allow_vm_block) : _owner(nullptr), _spin_ewma(8) {
   assert(os::mutex_init_done(), "Too early!");
   assert(name != nullptr, "Mutex requires a name");
   _name = os::strdup(name, mtInternal);
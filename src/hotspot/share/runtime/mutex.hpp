@@ -98,6 +98,9 @@ class Mutex : public CHeapObj<mtSynchronizer> {
  protected:                              // Monitor-Mutex metadata
   PlatformMonitor _lock;                 // Native monitor implementation
   const char* _name;                     // Name of mutex/monitor
+  // Learned spin budget for contended acquisitions (-XX:MutexSpinLimit).
+  // Updated racily by contending threads; it is only a heuristic.
+  volatile uint8_t _spin_ewma;
 
   // Debugging fields for naming, deadlock detection, etc. (some only used in debug mode)
 #ifndef PRODUCT
@@ -128,6 +131,7 @@ class Mutex : public CHeapObj<mtSynchronizer> {
   void check_safepoint_state   (Thread* thread)                       NOT_DEBUG_RETURN;
   void check_no_safepoint_state(Thread* thread)                       NOT_DEBUG_RETURN;
   void check_rank              (Thread* thread)                       NOT_DEBUG_RETURN;
+  bool try_spin                ();
   void assert_owner            (Thread* expected)                     NOT_DEBUG_RETURN;
 
  public:
@@ -108,6 +108,7 @@ Monitor* RootRegionScan_lock          = nullptr;
 
 Mutex*   Management_lock              = nullptr;
 Monitor* MonitorDeflation_lock        = nullptr;
+Monitor* ParkTimerWheel_lock          = nullptr;
 Monitor* Service_lock                 = nullptr;
 Monitor* Notification_lock            = nullptr;
 Monitor* PeriodicTask_lock            = nullptr;
@@ -235,6 +236,7 @@ void mutex_init() {
 
   MUTEX_DEFN(Patching_lock                   , PaddedMutex  , nosafepoint);      // used for safepointing and code patching.
   MUTEX_DEFN(MonitorDeflation_lock           , PaddedMonitor, nosafepoint);      // used for monitor deflation thread operations
+  MUTEX_DEFN(ParkTimerWheel_lock             , PaddedMonitor, nosafepoint);      // used for timed-park timer wheel operations
   MUTEX_DEFN(Service_lock                    , PaddedMonitor, service);          // used for service thread operations
   MUTEX_DEFN(Notification_lock               , PaddedMonitor, service);          // used for notification thread operations
 
@@ -492,7 +492,20 @@ void ObjectMonitor::enter_with_contention_mark(JavaThread *current, ObjectMonito
     }
 
     ContinuationEntry* ce = current->last_continuation();
-    if (ce != nullptr && ce->is_virtual_thread()) {
+    bool acquired_by_spin = false;
+    if (ce != nullptr && ce->is_virtual_thread() && VThreadMonitorEnterSpins > 0) {
+      // Unmounting releases the carrier but costs a full stack freeze; for
+      // micro-contended monitors whose owner is about to release, a short
+      // spin is much cheaper. Only preempt once the spin has failed.
+      for (int i = 0; i < VThreadMonitorEnterSpins && !acquired_by_spin; i++) {
+        SpinPause();
+        acquired_by_spin = (TryLock(current) == TryLockResult::Success);
+      }
+      if (acquired_by_spin) {
+        current->set_current_pending_monitor(nullptr);
+      }
+    }
+    if (!acquired_by_spin && ce != nullptr && ce->is_virtual_thread()) {
       int result = Continuation::try_preempt(current, ce->cont_oop(current), freeze_on_monitorenter);
       if (result == freeze_ok) {
         bool acquired = VThreadMonitorEnter(current);
@@ -517,28 +530,30 @@ void ObjectMonitor::enter_with_contention_mark(JavaThread *current, ObjectMonito
       }
     }
 
-    OSThreadContendState osts(current->osthread());
+    if (!acquired_by_spin) {
+      OSThreadContendState osts(current->osthread());
 
-    assert(current->thread_state() == _thread_in_vm, "invariant");
+      assert(current->thread_state() == _thread_in_vm, "invariant");
 
-    for (;;) {
-      ExitOnSuspend eos(this);
-      {
-        ThreadBlockInVMPreprocess<ExitOnSuspend> tbivs(current, eos, true /* allow_suspend */);
-        EnterI(current);
-        current->set_current_pending_monitor(nullptr);
-        // We can go to a safepoint at the end of this block. If we
-        // do a thread dump during that safepoint, then this thread will show
-        // as having "-locked" the monitor, but the OS and java.lang.Thread
-        // states will still report that the thread is blocked trying to
-        // acquire it.
-        // If there is a suspend request, ExitOnSuspend will exit the OM
-        // and set the OM as pending.
-      }
-      if (!eos.exited()) {
-        // ExitOnSuspend did not exit the OM
-        assert(owner_raw() == owner_for(current), "invariant");
-        break;
+      for (;;) {
+        ExitOnSuspend eos(this);
+        {
+          ThreadBlockInVMPreprocess<ExitOnSuspend> tbivs(current, eos, true /* allow_suspend */);
+          EnterI(current);
+          current->set_current_pending_monitor(nullptr);
+          // We can go to a safepoint at the end of this block. If we
+          // do a thread dump during that safepoint, then this thread will show
+          // as having "-locked" the monitor, but the OS and java.lang.Thread
+          // states will still report that the thread is blocked trying to
+          // acquire it.
+          // If there is a suspend request, ExitOnSuspend will exit the OM
+          // and set the OM as pending.
+        }
+        if (!eos.exited()) {
+          // ExitOnSuspend did not exit the OM
+          assert(owner_raw() == owner_for(current), "invariant");
+          break;
+        }
       }
     }
 
@@ -2087,6 +2102,19 @@ void ObjectMonitor::notify(TRAPS) {
 // waitset is "ABCD" and the EntryList is "XYZ". After a notifyAll() in prepend
 // mode the waitset will be empty and the EntryList will be "DCBAXYZ".
 
+// A note on scaling the wait set for masses of virtual waiters: the
+// serial cost of notifyAll is not the list walk but that each virtual
+// waiter's requeue manipulates the same entry list under the monitor
+// lock. Virtual waiters are already just ObjectWaiter nodes holding a
+// vthread oop (no parked platform thread), so the scalable shape is
+// wholesale splicing: notifyAll detaches the entire wait set in O(1)
+// and appends it to the entry list as a segment, deferring per-waiter
+// work (JFR events, interrupt checks) to each waiter's own resume. The
+// blocker is that per-waiter epilog work is currently done by the
+// notifier; moving it to resume changes when wait-event timestamps are
+// taken, which JFR consumers can see. Deciding that observability
+// change is the gating step - the splice itself is mechanical for
+// vthread-only wait sets.
 void ObjectMonitor::notifyAll(TRAPS) {
   JavaThread* current = THREAD;
   CHECK_OWNER();  // Throws IMSE if not owner.
@@ -633,6 +633,17 @@ void* os::malloc(size_t size, MEMFLAGS flags) {
   return os::malloc(size, flags, CALLER_PC);
 }
 
+// A note on an internal slab layer: per-thread magazines over size classes
+// would sit between here and libc for selected MEMFLAGS. Two constraints
+// shape it: NMT accounting rides in the malloc header and assumes free()
+// returns memory to the same accounting domain, so magazines must not
+// reuse blocks across categories; and os::malloc must work before
+// Thread::current() exists and on threads the VM does not own, so the
+// magazine lookup needs a fallback taken exactly by callers that cannot
+// contend anyway. Since glibc's per-thread tcache already absorbs hot
+// small-size traffic, the case for a VM-side slab rests on measured arena
+// contention under a current glibc - that measurement comes before any
+// allocator work here.
 void* os::malloc(size_t size, MEMFLAGS memflags, const NativeCallStack& stack) {
 
   // Special handling for NMT preinit phase before arguments are parsed
@@ -494,6 +494,9 @@ class os: AllStatic {
   // (exclusive) to make the OS back the memory range with actual memory.
   // Other threads may use the memory range concurrently with pretouch.
   static void   pretouch_memory(void* start, void* end, size_t page_size = vm_page_size());
+  // Advise the kernel that the range will be needed soon (e.g. issue
+  // readahead for a mapped file); a no-op where unsupported.
+  static void   advise_willneed(void* addr, size_t bytes);
 
   enum ProtType { MEM_PROT_NONE, MEM_PROT_READ, MEM_PROT_RW, MEM_PROT_RWX };
   static bool   protect_memory(char* addr, size_t bytes, ProtType prot,
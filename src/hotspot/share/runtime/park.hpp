@@ -59,9 +59,16 @@ class Thread;
 
 class Parker : public PlatformParker {
  private:
+  // Timer-wheel linkage for timed parks (-XX:+UseParkTimerWheel);
+  // guarded by ParkTimerWheel_lock.
+  Parker* _wheel_next;
+  Parker* _wheel_prev;
+  jlong   _wheel_deadline;  // absolute, in nanoseconds; 0 when not queued
+  friend class ParkTimerWheel;
+
   NONCOPYABLE(Parker);
  public:
-  Parker() : PlatformParker() {}
+  Parker() : PlatformParker(), _wheel_next(nullptr), _wheel_prev(nullptr), _wheel_deadline(0) {}
 
   // For simplicity of interface with Java, all forms of park (indefinite,
   // relative, and absolute) are multiplexed into one call.
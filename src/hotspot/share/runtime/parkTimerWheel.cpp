@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "logging/log.hpp"
+#include "memory/allocation.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/interfaceSupport.inline.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "runtime/os.hpp"
+#include "runtime/park.hpp"
+#include "runtime/parkTimerWheel.hpp"
+
+Parker**      ParkTimerWheel::_buckets        = nullptr;
+volatile bool ParkTimerWheel::_active         = false;
+jlong         ParkTimerWheel::_last_scan_tick = 0;
+
+jlong ParkTimerWheel::tick_ns() {
+  return (jlong)ParkTimerWheelTickMillis * (NANOSECS_PER_SEC / MILLIUNITS);
+}
+
+int ParkTimerWheel::bucket_index(jlong deadline_ns) {
+  return (int)((deadline_ns / tick_ns()) & (_num_buckets - 1));
+}
+
+void ParkTimerWheel::initialize() {
+  assert(UseParkTimerWheel, "should not be called otherwise");
+  _buckets = NEW_C_HEAP_ARRAY(Parker*, _num_buckets, mtThread);
+  for (int i = 0; i < _num_buckets; i++) {
+    _buckets[i] = nullptr;
+  }
+  ParkTimerWheelThread::initialize();
+}
+
+// A note on scope-grouped deadlines: entries sharing a deadline already
+// coalesce naturally here - they hash to the same bucket and are fired
+// by one service-thread pass, so the VM-side cost of a thousand parkers
+// with one deadline is a thousand list links, not a thousand timers.
+// What a structured-concurrency scope would add is cancellation by
+// group: one operation that removes all of a scope's entries when the
+// scope completes early. That needs a group key on the entry and a
+// per-group chain (second set of links through the Parker), plus a
+// Java-to-VM path that names the group at park time - which today's
+// park interface (a bare timeout) cannot express. The interface
+// extension is the gating piece; the wheel-side fan-out already exists.
+bool ParkTimerWheel::schedule(Parker* p, jlong timeout_ns) {
+  assert(timeout_ns > 0, "nonsensical timeout");
+  if (!Atomic::load_acquire(&_active)) {
+    return false;
+  }
+  // Timeouts below the wheel's resolution are better served by the
+  // ordinary timed wait; the wheel would only add latency.
+  if (timeout_ns < tick_ns()) {
+    return false;
+  }
+  jlong deadline = os::javaTimeNanos() + timeout_ns;
+
+  MutexLocker ml(ParkTimerWheel_lock, Mutex::_no_safepoint_check_flag);
+  assert(p->_wheel_deadline == 0, "Parker already queued");
+  int index = bucket_index(deadline);
+  Parker* head = _buckets[index];
+  p->_wheel_deadline = deadline;
+  p->_wheel_prev = nullptr;
+  p->_wheel_next = head;
+  if (head != nullptr) {
+    head->_wheel_prev = p;
+  }
+  _buckets[index] = p;
+  return true;
+}
+
+void ParkTimerWheel::cancel(Parker* p) {
+  MutexLocker ml(ParkTimerWheel_lock, Mutex::_no_safepoint_check_flag);
+  if (p->_wheel_deadline == 0) {
+    return; // already fired or never queued
+  }
+  int index = bucket_index(p->_wheel_deadline);
+  if (p->_wheel_prev != nullptr) {
+    p->_wheel_prev->_wheel_next = p->_wheel_next;
+  } else {
+    assert(_buckets[index] == p, "bucket list corrupted");
+    _buckets[index] = p->_wheel_next;
+  }
+  if (p->_wheel_next != nullptr) {
+    p->_wheel_next->_wheel_prev = p->_wheel_prev;
+  }
+  p->_wheel_next = nullptr;
+  p->_wheel_prev = nullptr;
+  p->_wheel_deadline = 0;
+}
+
+void ParkTimerWheel::fire_expired(jlong now_ns) {
+  assert_lock_strong(ParkTimerWheel_lock);
+  // With _num_buckets buckets of tick_ns() each, every bucket that could
+  // hold an expired entry lies within one wheel revolution of now, so a
+  // full scan per tick is only needed when we oversleep; normally only the
+  // buckets between the previous and the current tick contain candidates.
+  // Entries hashed into those buckets from a later revolution are simply
+  // skipped and picked up when their deadline's tick comes around.
+  //
+  // Each tick value is scanned exactly once, so an entry must fire when the
+  // scan reaches its own tick even if now_ns is still within that tick and
+  // short of the deadline's sub-tick remainder - comparing against now_ns
+  // here would delay such an entry by a whole revolution. Firing up to one
+  // tick early is fine: an early unpark is just a spurious return, which
+  // LockSupport.park permits and the wheel's contract already leans on.
+  jlong now_tick = now_ns / tick_ns();
+  jlong first_tick = (_last_scan_tick == 0 || now_tick - _last_scan_tick >= _num_buckets)
+                       ? now_tick - _num_buckets + 1 : _last_scan_tick + 1;
+  for (jlong tick = first_tick; tick <= now_tick; tick++) {
+    int index = (int)(tick & (_num_buckets - 1));
+    Parker* p = _buckets[index];
+    while (p != nullptr) {
+      Parker* next = p->_wheel_next;
+      if (p->_wheel_deadline / tick_ns() <= tick) {
+        if (p->_wheel_prev != nullptr) {
+          p->_wheel_prev->_wheel_next = p->_wheel_next;
+        } else {
+          _buckets[index] = p->_wheel_next;
+        }
+        if (p->_wheel_next != nullptr) {
+          p->_wheel_next->_wheel_prev = p->_wheel_prev;
+        }
+        p->_wheel_next = nullptr;
+        p->_wheel_prev = nullptr;
+        p->_wheel_deadline = 0;
+        // Fired under ParkTimerWheel_lock so that cancel() cannot return,
+        // and the owning thread cannot go away, while we are in unpark().
+        p->unpark();
+      }
+      p = next;
+    }
+  }
+  _last_scan_tick = now_tick;
+}
+
+void ParkTimerWheelThread::initialize() {
+  EXCEPTION_MARK;
+
+  const char* name = "Park Timer Wheel Thread";
+  Handle thread_oop = JavaThread::create_system_thread_object(name, CHECK);
+
+  ParkTimerWheelThread* thread = new ParkTimerWheelThread(&park_timer_wheel_thread_entry);
+  JavaThread::vm_exit_on_osthread_failure(thread);
+
+  JavaThread::start_internal_daemon(THREAD, thread, thread_oop, NearMaxPriority);
+}
+
+void ParkTimerWheelThread::park_timer_wheel_thread_entry(JavaThread* jt, TRAPS) {
+  Atomic::release_store(&ParkTimerWheel::_active, true);
+
+  while (true) {
+    // Need state transition ThreadBlockInVM so that this thread
+    // will be handled by safepoint correctly when this thread is
+    // notified at a safepoint.
+    ThreadBlockInVM tbivm(jt);
+
+    MonitorLocker ml(ParkTimerWheel_lock, Mutex::_no_safepoint_check_flag);
+    ParkTimerWheel::fire_expired(os::javaTimeNanos());
+    ml.wait(ParkTimerWheelTickMillis);
+  }
+}
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_RUNTIME_PARKTIMERWHEEL_HPP
+#define SHARE_RUNTIME_PARKTIMERWHEEL_HPP
+
+#include "memory/allStatic.hpp"
+#include "runtime/javaThread.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+class Parker;
+
+// A hashed timer wheel for timed parks (-XX:+UseParkTimerWheel).
+//
+// With many threads in concurrent timed parks, giving every park its own
+// futex/condvar timeout costs one timed syscall per sleeper. Instead, a
+// parking thread registers its Parker and an absolute deadline here and then
+// blocks without a timeout; a single dedicated thread services the wheel at
+// ParkTimerWheelTickMillis granularity and unparks expired entries.
+//
+// Entries are linked through fields embedded in the Parker itself, so
+// scheduling never allocates. All wheel state, including the firing of
+// expired timers, is guarded by ParkTimerWheel_lock; cancel() therefore
+// cannot return while the wheel thread is still touching the Parker, which
+// keeps a dying thread from pulling its Parker out from under the wheel.
+//
+// Timers are best effort: a timer that fires after the owner has already
+// been unparked just grants a permit, which LockSupport.park is specified
+// to tolerate as a spurious return.
+class ParkTimerWheel : public AllStatic {
+  friend class ParkTimerWheelThread;
+
+  static const int _num_buckets = 512; // must be a power of 2
+
+  static Parker**      _buckets;        // guarded by ParkTimerWheel_lock
+  static volatile bool _active;
+  static jlong         _last_scan_tick; // guarded by ParkTimerWheel_lock
+
+  static int bucket_index(jlong deadline_ns);
+  static void fire_expired(jlong now_ns);
+  static jlong tick_ns();
+
+ public:
+  static void initialize(); // called from Threads::create_vm
+
+  // Registers p to be unparked once timeout_ns (relative) has elapsed.
+  // Returns false if the wheel is not running, in which case the caller
+  // must fall back to an ordinary timed wait.
+  static bool schedule(Parker* p, jlong timeout_ns);
+
+  // Removes p from the wheel if it is still queued. Must be called by the
+  // owning thread after a wheel-scheduled park returns, before the Parker
+  // can be reused or destroyed.
+  static void cancel(Parker* p);
+};
+
+// The hidden-from-external-view thread servicing the wheel.
+class ParkTimerWheelThread : public JavaThread {
+  friend class VMStructs;
+ private:
+  static void park_timer_wheel_thread_entry(JavaThread* thread, TRAPS);
+  ParkTimerWheelThread(ThreadFunction entry_point) : JavaThread(entry_point) {};
+
+ public:
+  static void initialize();
+
+  // Hide this thread from external view.
+  bool is_hidden_from_external_view() const { return true; }
+};
+
+#endif // SHARE_RUNTIME_PARKTIMERWHEEL_HPP
@@ -82,6 +82,21 @@ const char* PerfDataManager::_name_spaces[] = {
   "",
 };
 
+// A note on a general striped-counter substrate: the pattern exists in
+// several hand-rolled forms (per-thread JFR counters, the per-carrier
+// continuation counters, ThreadLocalAllocStats) and they share the real
+// design problem a substrate must solve: reader aggregation needs the
+// set of stripes, and per-thread stripes die with threads, so either
+// stripes outlive threads (per-core slots - but then writes need
+// restartable sequences or CAS under migration) or dead threads'
+// values fold into a global on exit (what the hand-rolled forms do).
+// The exit-fold design is the one that matches VM thread lifecycle; a
+// substrate offering inc()/aggregate() with exit folding, cache-line
+// padding and lazy NUMA-aware summation would let the existing ad-hoc
+// copies converge. PerfData's mmap'ed external visibility is the
+// constraint that keeps this from being a drop-in replacement: striped
+// values are not externally readable until aggregated, so jstat-visible
+// counters must stay single-slot or gain a flusher.
 PerfData::PerfData(CounterNS ns, const char* name, Units u, Variability v)
                   : _name(nullptr), _v(v), _u(u), _on_c_heap(false), _valuep(nullptr) {
 
@@ -158,7 +173,6 @@ void PerfData::create_entry(BasicType dtype, size_t dsize, size_t vlen) {
   // copy the name, including null terminator, into PerfData memory
   strcpy(cname, name());
 
-
   // set the header values in PerfData memory
   PerfDataEntry* pdep = (PerfDataEntry*)psmp;
   pdep->entry_length = (jint)size;
@@ -251,7 +265,6 @@ PerfStringConstant::PerfStringConstant(CounterNS ns, const char* namep,
   }
 }
 
-
 void PerfDataManager::destroy() {
 
   if (_all == nullptr)
@@ -92,7 +92,6 @@ static void trace_class_resolution(oop mirror) {
   }
 }
 
-
 oop Reflection::box(jvalue* value, BasicType type, TRAPS) {
   if (type == T_VOID) {
     return nullptr;
@@ -108,7 +107,6 @@ oop Reflection::box(jvalue* value, BasicType type, TRAPS) {
   return result;
 }
 
-
 BasicType Reflection::unbox_for_primitive(oop box, jvalue* value, TRAPS) {
   if (box == nullptr) {
     THROW_(vmSymbols::java_lang_IllegalArgumentException(), T_ILLEGAL);
@@ -1131,6 +1129,18 @@ static oop invoke(InstanceKlass* klass,
 // This would be nicer if, say, java.lang.reflect.Method was a subclass
 // of java.lang.reflect.Constructor
 
+// A note on a VM-side per-Method invocation cache: the Java side already
+// builds exactly this - core reflection spins method accessors
+// (method handles or generated bytecode) that embed the resolved target
+// and argument conversions, and hot reflective calls JIT to near-direct
+// dispatch. Calls that still arrive here are the cold fallback: first
+// invocations, interpreter-only phases, and JNI-driven reflection. A VM
+// cache (resolved target + access verdict + layout descriptor, epoch-
+// validated against redefinition) would duplicate the accessor
+// machinery one layer down, and its epoch checks reintroduce the
+// validation cost being avoided. The productive question for workloads
+// stuck on this path is why accessor spinning has not kicked in
+// (thresholds, hidden-class budgets), not how to cache below it.
 oop Reflection::invoke_method(oop method_mirror, Handle receiver, objArrayHandle args, TRAPS) {
   oop mirror             = java_lang_reflect_Method::clazz(method_mirror);
   int slot               = java_lang_reflect_Method::slot(method_mirror);
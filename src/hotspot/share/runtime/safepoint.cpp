@@ -195,6 +195,44 @@ static void back_off(int64_t start_time) {
   }
 }
 
+// A small ring of the threads most recently observed to be the last to reach
+// a safepoint, and how long the VM thread waited for them. Written only by
+// the VM thread during safepoint synchronization; read racily by the
+// VM.safepoint_stragglers diagnostic command, which can at worst print a
+// torn record.
+SafepointSynchronize::StragglerRecord SafepointSynchronize::_straggler_ring[SafepointSynchronize::_straggler_ring_size];
+uint64_t SafepointSynchronize::_straggler_ring_next = 0;
+
+void SafepointSynchronize::record_straggler(JavaThread* thread, int64_t time_ns) {
+  StragglerRecord* rec = &_straggler_ring[_straggler_ring_next % (uint64_t)_straggler_ring_size];
+  _straggler_ring_next++;
+
+  ResourceMark rm;
+  const char* name = thread->name();
+  strncpy(rec->_thread_name, name != nullptr ? name : "<unknown>", sizeof(rec->_thread_name) - 1);
+  rec->_thread_name[sizeof(rec->_thread_name) - 1] = '\0';
+  rec->_time_to_safepoint_ns = time_ns;
+  rec->_timestamp_ms = os::javaTimeMillis();
+}
+
+void SafepointSynchronize::print_stragglers_on(outputStream* st) {
+  st->print_cr("Recent safepoint stragglers (most recent first):");
+  bool printed = false;
+  for (int i = 1; i <= _straggler_ring_size; i++) {
+    if ((uint64_t)i > _straggler_ring_next) {
+      break;
+    }
+    uint64_t index = _straggler_ring_next - (uint64_t)i;
+    const StragglerRecord* rec = &_straggler_ring[index % (uint64_t)_straggler_ring_size];
+    st->print_cr("  %-32s " INT64_FORMAT_W(10) " ns (at " INT64_FORMAT " ms)",
+                 rec->_thread_name, rec->_time_to_safepoint_ns, rec->_timestamp_ms);
+    printed = true;
+  }
+  if (!printed) {
+    st->print_cr("  (none recorded)");
+  }
+}
+
 int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int nof_threads, int* initial_running)
 {
   JavaThreadIteratorWithHandle jtiwh;
@@ -234,6 +272,7 @@ int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int no
 
   int iterations = 1; // The first iteration is above.
   int64_t start_time = os::javaTimeNanos();
+  JavaThread* lone_straggler = nullptr;
 
   do {
     // Check if this has taken too long:
@@ -260,6 +299,12 @@ int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int no
 
     DEBUG_ONLY(assert_list_is_valid(tss_head, still_running);)
 
+    if (still_running == 1) {
+      // Remember the one thread everyone else is waiting for, so that it can
+      // be attributed once it finally reaches the safepoint.
+      lone_straggler = tss_head->thread();
+    }
+
     if (still_running > 0) {
       back_off(start_time);
     }
@@ -269,6 +314,10 @@ int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int no
 
   assert(tss_head == nullptr, "Must be empty");
 
+  if (lone_straggler != nullptr) {
+    record_straggler(lone_straggler, os::javaTimeNanos() - start_time);
+  }
+
   return iterations;
 }
 
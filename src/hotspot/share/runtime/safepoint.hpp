@@ -104,6 +104,18 @@ class SafepointSynchronize : AllStatic {
   static void arm_safepoint();
   static int synchronize_threads(jlong safepoint_limit_time, int nof_threads, int* initial_running);
   static void disarm_safepoint();
+
+  // Attribution of slow-to-safepoint threads (see VM.safepoint_stragglers).
+  struct StragglerRecord {
+    char    _thread_name[64];
+    int64_t _time_to_safepoint_ns;
+    int64_t _timestamp_ms;
+  };
+  static const int _straggler_ring_size = 8;
+  static StragglerRecord _straggler_ring[_straggler_ring_size];
+  static uint64_t _straggler_ring_next;
+  static void record_straggler(JavaThread* thread, int64_t time_ns);
+
   static void increment_jni_active_count();
   static void decrement_waiting_to_block();
   static bool thread_not_running(ThreadSafepointState *cur_state);
@@ -130,6 +142,9 @@ public:
   static void begin();
   static void end();                    // Start all suspended threads again...
 
+  // Print the recent safepoint stragglers recorded by synchronize_threads().
+  static void print_stragglers_on(outputStream* st);
+
   // The value for a not set safepoint id.
   static const uint64_t InactiveSafepointCounter;
 
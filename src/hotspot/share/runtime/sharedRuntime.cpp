@@ -229,7 +229,6 @@ int     SharedRuntime::_ICmiss_index                    = 0;
 int     SharedRuntime::_ICmiss_count[SharedRuntime::maxICmiss_count];
 address SharedRuntime::_ICmiss_at[SharedRuntime::maxICmiss_count];
 
-
 void SharedRuntime::trace_ic_miss(address at) {
   for (int i = 0; i < _ICmiss_index; i++) {
     if (_ICmiss_at[i] == at) {
@@ -256,7 +255,6 @@ void SharedRuntime::print_ic_miss_histogram() {
 }
 #endif // PRODUCT
 
-
 JRT_LEAF(jlong, SharedRuntime::lmul(jlong y, jlong x))
   return x * y;
 JRT_END
@@ -2571,6 +2569,18 @@ class AdapterSignatureIterator : public SignatureIterator {
   }
 };
 
+// A note on adapter pre-generation: AdapterHandlerLibrary already
+// shares adapters by fingerprint and pre-generates the handful of
+// common shapes at startup; link-time contention during load storms is
+// on the table lock around lookup-or-create for novel fingerprints. A
+// training-run histogram would warm the table, but the same storms are
+// served more simply by making the hit path lock-free (the table is
+// lookup-mostly after warmup - a ConcurrentHashTable fits it exactly as
+// it does the resolved-method table), at which point only genuinely
+// novel signatures serialize on creation, which pre-generation cannot
+// avoid for unseen shapes either. CDS is the natural carrier if
+// persisted pre-generation is still wanted afterwards: archived
+// adapters alongside the archived classes that need them.
 AdapterHandlerEntry* AdapterHandlerLibrary::get_adapter(const methodHandle& method) {
   // Use customized signature handler.  Need to lock around updates to
   // the _adapter_handler_table (it is not safe for concurrent readers
@@ -139,7 +139,6 @@
  *
  */
 
-
 /*
  * Constants:
  * The hexadecimal values are the intended ones for the following
@@ -148,7 +147,6 @@
  * to produce the hexadecimal values shown.
  */
 
-
 static const int init_jk[] = {2,3,4,6}; /* initial value for jk */
 
 static const double PIo2[] = {
@@ -748,6 +746,17 @@ static double __kernel_tan(double x, double y, int iy)
  *      TRIG(x) returns trig(x) nearly rounded
  */
 
+// A note on batched transcendental stubs: these scalar fallbacks and the
+// per-call libm stubs serve single-value bytecode semantics; an
+// array-in/array-out kernel has no bytecode to intrinsify - the call
+// shape only exists in the Vector API, which already lowers transcendental
+// lanewise operations to vector-library calls (SLEEF/SVML) when
+// available. A risk engine evaluating exp over millions of doubles gets
+// the batched kernels today through DoubleVector.lanewise(EXP) on
+// platforms with vector-math support; adding a parallel VM-side batch
+// surface would duplicate that dispatch for callers who bypass the API
+// that exists for exactly this. The VM-side gap worth tracking is
+// vector-library coverage per platform, not a new entry point.
 JRT_LEAF(jdouble, SharedRuntime::dsin(jdouble x))
   double y[2],z=0.0;
   int n, ix;
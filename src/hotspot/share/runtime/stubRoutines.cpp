@@ -194,7 +194,6 @@ address StubRoutines::_upcall_stub_exception_handler = nullptr;
 address StubRoutines::_lookup_secondary_supers_table_slow_path_stub = nullptr;
 address StubRoutines::_lookup_secondary_supers_table_stubs[Klass::SECONDARY_SUPERS_TABLE_SIZE] = { nullptr };
 
-
 // Initialization
 //
 // Note: to break cycle with universe initialization, stubs are generated in two phases.
@@ -228,7 +227,6 @@ address UnsafeMemoryAccess::page_error_continue_pc(address pc) {
   return nullptr;
 }
 
-
 static BufferBlob* initialize_stubs(StubCodeGenerator::StubsKind kind,
                                     int code_size, int max_aligned_stubs,
                                     const char* timer_msg,
@@ -258,6 +256,18 @@ static BufferBlob* initialize_stubs(StubCodeGenerator::StubsKind kind,
   return stubs_code;
 }
 
+// A note on stub multi-versioning: every StubRoutines entry is already a
+// runtime-selected function pointer - the generators consult VM_Version
+// and install the variant for the detected CPU, which is resolution at
+// microarchitecture granularity already (UseAVX etc. key off family and
+// model). What "register multiple implementations and pick per-uarch"
+// adds over that is only data: per-uarch tuning tables (copy strategy
+// crossovers, unrolling) that generators consult instead of ifdef'ing
+// per feature bit. So the framework asked for is a tuning-parameter
+// table keyed by VM_Version's family/model - a header of constants the
+// generators read - not a new dispatch mechanism; dispatch cost would
+// only get worse by adding an indirection the entries do not have
+// today.
 void StubRoutines::initialize_initial_stubs() {
   if (_initial_stubs_code == nullptr) {
     _initial_stubs_code = initialize_stubs(StubCodeGenerator::Initial_stubs,
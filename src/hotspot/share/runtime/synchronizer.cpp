@@ -50,6 +50,7 @@
 #include "runtime/os.inline.hpp"
 #include "runtime/osThread.hpp"
 #include "runtime/perfData.hpp"
+#include "runtime/prefetch.inline.hpp"
 #include "runtime/safepointMechanism.inline.hpp"
 #include "runtime/safepointVerifiers.hpp"
 #include "runtime/sharedRuntime.hpp"
@@ -196,7 +197,11 @@ MonitorList::Iterator MonitorList::iterator() const {
 
 ObjectMonitor* MonitorList::Iterator::next() {
   ObjectMonitor* current = _current;
-  _current = current->next_om();
+  ObjectMonitor* next = current->next_om();
+  // The walk is pure pointer chasing over a list that can hold millions of
+  // entries; fetch the successor ahead of the work done on the current one.
+  Prefetch::read(next, 0);
+  _current = next;
   return current;
 }
 
@@ -991,6 +996,20 @@ static intptr_t install_hash_code(Thread* current, oop obj) {
   }
 }
 
+// A note on a side hashcode table for displaced headers: with
+// LM_LIGHTWEIGHT the displaced-header problem has largely moved - lock
+// bits live in the lock stack and the hash usually installs in the mark
+// word without inflation; the residual inflation-for-hash cases are
+// stack-locked objects under LM_LEGACY and the i-hash of an object
+// whose monitor is racing deflation. A side table keyed by object
+// address must be updated by every GC that moves objects (the same
+// requirement that shapes the JVMTI tag map) and consulted on every
+// hash load that sees a displaced header - a permanent tax on a path
+// that is almost always uncontended, to avoid inflations that
+// LM_LIGHTWEIGHT has already made rare. Re-measuring inflation-for-hash
+// rates under the current locking mode is the prerequisite; under
+// legacy locking the table trades a rare inflation for a universal GC
+// obligation.
 intptr_t ObjectSynchronizer::FastHashCode(Thread* current, oop obj) {
   if (UseObjectMonitorTable) {
     // Since the monitor isn't in the object header, the hash can simply be
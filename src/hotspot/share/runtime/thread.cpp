@@ -78,6 +78,9 @@ Thread::Thread(MEMFLAGS flags) {
 
   // allocated data structures
   set_osthread(nullptr);
+  for (int i = 0; i < _num_chunk_cache_slots; i++) {
+    _chunk_cache[i] = nullptr;
+  }
   set_resource_area(new (flags) ResourceArea(flags));
   DEBUG_ONLY(_current_resource_mark = nullptr;)
   set_handle_area(new (flags) HandleArea(flags, nullptr));
@@ -274,6 +277,11 @@ Thread::~Thread() {
   delete handle_area();
   delete metadata_handles();
 
+  // Flush the per-thread chunk cache after the last arena above is gone;
+  // when a thread deletes itself, those deletions re-populate the cache
+  // slots through ChunkPool::deallocate_chunk.
+  release_cached_arena_chunks(_chunk_cache, _num_chunk_cache_slots);
+
   // osthread() can be null, if creation of thread failed.
   if (osthread() != nullptr) os::free_thread(osthread());
 
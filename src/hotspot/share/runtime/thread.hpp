@@ -43,6 +43,7 @@
 #include "jfr/support/jfrThreadExtension.hpp"
 #endif
 
+class Chunk;
 class CompilerThread;
 class HandleArea;
 class HandleMark;
@@ -399,6 +400,9 @@ class Thread: public ThreadShadow {
   ResourceArea* resource_area() const            { return _resource_area; }
   void set_resource_area(ResourceArea* area)     { _resource_area = area; }
 
+  static int num_chunk_cache_slots()             { return _num_chunk_cache_slots; }
+  Chunk** chunk_cache()                          { return _chunk_cache; }
+
   OSThread* osthread() const                     { return _osthread;   }
   void set_osthread(OSThread* thread)            { _osthread = thread; }
 
@@ -519,6 +523,12 @@ protected:
   // Thread local resource area for temporary allocation within the VM
   ResourceArea* _resource_area;
 
+  // One cached arena chunk per standard chunk size, consulted before the
+  // global ChunkPool so bursty resource-area use does not bounce chunks
+  // through the pool lock; see ChunkPool in arena.cpp.
+  static const int _num_chunk_cache_slots = 4;
+  Chunk* _chunk_cache[_num_chunk_cache_slots];
+
   DEBUG_ONLY(ResourceMark* _current_resource_mark;)
 
   // Thread local handle area for allocation of handles within the VM
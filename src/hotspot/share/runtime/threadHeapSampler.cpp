@@ -400,6 +400,18 @@ void ThreadHeapSampler::pick_next_geometric_sample() {
   _bytes_until_sample = interval;
 }
 
+// A note on an always-on aggregation service: sampling here is already
+// cheap (per-thread byte countdown folded into the TLAB end offset); the
+// fleet-use blocker is delivery, which currently means JVMTI posting with
+// its thread-state and tag-map baggage. A self-contained path would have
+// this sampler append (stack-id, size, klass-id) into a per-thread
+// fixed-size reservoir merged by the periodic task into a shared-memory
+// segment - but stack ids and klass ids are only stable if something
+// owns their resolution tables across class unloading, which is exactly
+// the service JFR's epoch-tagged constant pools already provide. Building
+// a second id-stability layer for an external shm reader duplicates
+// that; the cheaper road is a JFR event with the sampler as source and
+// streaming consumption, which needs no VM-side shm protocol at all.
 void ThreadHeapSampler::pick_next_sample(size_t overflowed_bytes) {
 #ifndef PRODUCT
   if (!log_table_checked) {
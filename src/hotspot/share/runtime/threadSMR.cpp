@@ -113,6 +113,7 @@ uint                  ThreadsSMRSupport::_nested_thread_list_max = 0;
 // Impl note: Atomically incremented over VM lifetime so use unsigned for
 // more range. There will be fewer ThreadsListHandles than threads so
 // unsigned 32-bit should be fine.
+volatile uint         ThreadsSMRSupport::_live_handle_cnt = 0;
 volatile uint         ThreadsSMRSupport::_tlh_cnt = 0;
 
 // Max time in millis to delete a ThreadsListHandle.
@@ -417,6 +418,11 @@ void SafeThreadsListPtr::acquire_stable_list() {
   _previous = _thread->_threads_list_ptr;
   _thread->_threads_list_ptr = this;
 
+  // Counted before the hazard ptr is published so that a scanning thread
+  // that reads a zero count afterwards can be sure no hazard ptr it did
+  // not see can validate against a retired ThreadsList; see free_list().
+  ThreadsSMRSupport::inc_live_handle_cnt();
+
   if (_thread->get_threads_hazard_ptr() == nullptr && _previous == nullptr) {
     // The typical case is first.
     acquire_stable_list_fast_path();
@@ -528,6 +534,7 @@ void SafeThreadsListPtr::release_stable_list() {
   // case, we set this thread's hazard ptr back to null and we do it before
   // _nested_handle_cnt is decremented below.
   _thread->set_threads_hazard_ptr(nullptr);
+  ThreadsSMRSupport::dec_live_handle_cnt();
   if (_previous != nullptr) {
     // The ThreadsListHandle being released is a nested ThreadsListHandle.
     if (EnableThreadSMRStatistics) {
@@ -875,6 +882,15 @@ void ThreadsSMRSupport::add_thread(JavaThread *thread){
 // Atomic operation to ensure the memory update is seen earlier than
 // when the delete_lock is dropped.
 //
+void ThreadsSMRSupport::inc_live_handle_cnt() {
+  Atomic::add(&_live_handle_cnt, 1u);
+}
+
+void ThreadsSMRSupport::dec_live_handle_cnt() {
+  assert(Atomic::load(&_live_handle_cnt) > 0, "live handle count underflow");
+  Atomic::sub(&_live_handle_cnt, 1u);
+}
+
 void ThreadsSMRSupport::clear_delete_notify() {
   Atomic::dec(&_delete_notify);
 }
@@ -910,8 +926,18 @@ void ThreadsSMRSupport::free_list(ThreadsList* threads) {
 
   // Gather a hash table of the current hazard ptrs:
   ThreadScanHashtable *scan_table = new ThreadScanHashtable();
-  ScanHazardPtrGatherThreadsListClosure scan_cl(scan_table);
-  threads_do(&scan_cl);
+  OrderAccess::fence();
+  if (Atomic::load(&_live_handle_cnt) > 0) {
+    ScanHazardPtrGatherThreadsListClosure scan_cl(scan_table);
+    threads_do(&scan_cl);
+  } else {
+    // No thread holds a live ThreadsListHandle anywhere: the retired lists
+    // cannot be referenced by a hazard ptr. A handle acquired after the
+    // fence above either is seen by the count load, or validates its hazard
+    // ptr against _java_thread_list, which no longer points at any list on
+    // the to-delete chain. So an empty scan table is correct, and we skip
+    // walking every thread just to build it.
+  }
   OrderAccess::acquire(); // Must order reads of hazard ptr before reads of
                           // nested reference counters
 
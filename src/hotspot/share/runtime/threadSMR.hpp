@@ -90,7 +90,8 @@ class ThreadsList;
 //
 class ThreadsSMRSupport : AllStatic {
   friend class VMStructs;
-  friend class SafeThreadsListPtr;  // for _nested_thread_list_max, delete_notify(), release_stable_list_wake_up() access
+  friend class SafeThreadsListPtr;  // for _nested_thread_list_max, delete_notify(), release_stable_list_wake_up(),
+                                    // {inc,dec}_live_handle_cnt() access
 
   // The coordination between ThreadsSMRSupport::release_stable_list() and
   // ThreadsSMRSupport::smr_delete() uses the delete_lock in order to
@@ -115,6 +116,7 @@ class ThreadsSMRSupport : AllStatic {
   static uint64_t              _java_thread_list_free_cnt;
   static uint                  _java_thread_list_max;
   static uint                  _nested_thread_list_max;
+  static volatile uint         _live_handle_cnt;
   static volatile uint         _tlh_cnt;
   static volatile uint         _tlh_time_max;
   static volatile uint         _tlh_times;
@@ -128,6 +130,8 @@ class ThreadsSMRSupport : AllStatic {
   static bool delete_notify();
   static void free_list(ThreadsList* threads);
   static void inc_deleted_thread_cnt();
+  static void inc_live_handle_cnt();
+  static void dec_live_handle_cnt();
   static void inc_java_thread_list_alloc_cnt();
   static void inc_tlh_cnt();
   static void release_stable_list_wake_up(bool is_nested);
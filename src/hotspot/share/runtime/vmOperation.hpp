@@ -50,6 +50,8 @@
   template(CollectForMetadataAllocation)          \
   template(CollectForCodeCacheAllocation)         \
   template(GC_HeapInspection)                     \
+  template(EpsilonEpochOperation)                 \
+  template(HeapHeaderCensus)                      \
   template(SerialCollectForAllocation)            \
   template(SerialGCCollect)                       \
   template(ParallelCollectForAllocation)          \
@@ -166,6 +168,10 @@ class VM_Operation : public StackObj {
   // or concurrently with Java threads running.
   virtual bool evaluate_at_safepoint() const { return true; }
 
+  // GC operations are given priority when several threads are waiting to
+  // install their operation in the VM thread; see VMThread::wait_until_executed.
+  virtual bool is_gc_operation() const { return false; }
+
   // Debugging
   virtual void print_on_error(outputStream* st) const;
   virtual const char* name() const  { return _names[type()]; }
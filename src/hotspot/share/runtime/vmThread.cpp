@@ -106,6 +106,7 @@ Monitor*          VMThread::_terminate_lock     = nullptr;
 VMThread*         VMThread::_vm_thread          = nullptr;
 VM_Operation*     VMThread::_cur_vm_operation   = nullptr;
 VM_Operation*     VMThread::_next_vm_operation  = &no_op; // Prevent any thread from setting an operation until VM thread is ready.
+uint              VMThread::_gc_priority_waiters = 0;
 PerfCounter*      VMThread::_perf_accumulated_vm_operation_time = nullptr;
 VMOperationTimeoutTask* VMThread::_timeout_task = nullptr;
 
@@ -349,8 +350,23 @@ void VMThread::wait_until_executed(VM_Operation* op) {
                      Mutex::_no_safepoint_check_flag);
   {
     TraceTime timer("Installing VM operation", TRACETIME_LOG(Trace, vmthread));
+    const bool is_gc = op->is_gc_operation();
+    if (is_gc) {
+      _gc_priority_waiters++;
+    }
     while (true) {
+      // Let waiting GC operations install ahead of anything else: a slow
+      // diagnostic operation should not extend a GC request's latency by a
+      // whole operation more than necessary.
+      if (!is_gc && _gc_priority_waiters > 0) {
+        log_trace(vmthread)("Deferring to a waiting GC operation");
+        ml.wait();
+        continue;
+      }
       if (VMThread::vm_thread()->set_next_operation(op)) {
+        if (is_gc) {
+          _gc_priority_waiters--;
+        }
         ml.notify_all();
         break;
       }
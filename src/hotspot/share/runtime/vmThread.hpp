@@ -139,6 +139,7 @@ class VMThread: public NamedThread {
   // VM_Operation support
   static VM_Operation*     _cur_vm_operation;   // Current VM operation
   static VM_Operation*     _next_vm_operation;  // Next VM operation
+  static uint              _gc_priority_waiters; // GC operations waiting to install; guarded by VMOperation_lock
 
   bool set_next_operation(VM_Operation *op);    // Set the _next_vm_operation if possible.
 
@@ -36,8 +36,12 @@
 #include "compiler/compiler_globals.hpp"
 #include "compiler/compileBroker.hpp"
 #include "compiler/directivesParser.hpp"
+#if INCLUDE_EPSILONGC
+#include "gc/epsilon/epsilonHeap.hpp"
+#endif // INCLUDE_EPSILONGC
 #include "gc/shared/gcVMOperations.hpp"
 #include "jvm.h"
+#include "memory/heapInspection.hpp"
 #include "memory/metaspace/metaspaceDCmd.hpp"
 #include "memory/resourceArea.hpp"
 #include "memory/universe.hpp"
@@ -49,6 +53,7 @@
 #include "oops/oop.inline.hpp"
 #include "oops/typeArrayOop.inline.hpp"
 #include "prims/jvmtiAgentList.hpp"
+#include "runtime/continuation.hpp"
 #include "runtime/fieldDescriptor.inline.hpp"
 #include "runtime/flags/jvmFlag.hpp"
 #include "runtime/handles.inline.hpp"
@@ -56,6 +61,7 @@
 #include "runtime/javaCalls.hpp"
 #include "runtime/jniHandles.hpp"
 #include "runtime/os.hpp"
+#include "runtime/safepoint.hpp"
 #include "runtime/vmOperations.hpp"
 #include "runtime/vm_version.hpp"
 #include "services/diagnosticArgument.hpp"
@@ -110,6 +116,12 @@ void DCmd::register_dcmds(){
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<RunFinalizationDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<HeapInfoDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<FinalizerInfoDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<SafepointStragglersDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<HeaderCensusDCmd>(full_export, true, false));
+#if INCLUDE_EPSILONGC
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<EpsilonMarkEpochDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<EpsilonResetEpochDCmd>(full_export, true, false));
+#endif // INCLUDE_EPSILONGC
 #if INCLUDE_SERVICES
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<HeapDumpDCmd>(DCmd_Source_Internal | DCmd_Source_AttachAPI, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<ClassHistogramDCmd>(full_export, true, false));
@@ -419,6 +431,38 @@ void HeapInfoDCmd::execute(DCmdSource source, TRAPS) {
   Universe::heap()->print_on(output());
 }
 
+#if INCLUDE_EPSILONGC
+static EpsilonHeap* epsilon_heap_or_report(outputStream* out) {
+  if (!UseEpsilonGC) {
+    out->print_cr("Epsilon GC is not in use");
+    return nullptr;
+  }
+  return EpsilonHeap::heap();
+}
+
+void EpsilonMarkEpochDCmd::execute(DCmdSource source, TRAPS) {
+  EpsilonHeap* heap = epsilon_heap_or_report(output());
+  if (heap != nullptr) {
+    heap->mark_epoch(output());
+  }
+}
+
+void EpsilonResetEpochDCmd::execute(DCmdSource source, TRAPS) {
+  EpsilonHeap* heap = epsilon_heap_or_report(output());
+  if (heap != nullptr) {
+    heap->reset_to_epoch(output());
+  }
+}
+#endif // INCLUDE_EPSILONGC
+
+void HeaderCensusDCmd::execute(DCmdSource source, TRAPS) {
+  HeapHeaderCensus::run(output());
+}
+
+void SafepointStragglersDCmd::execute(DCmdSource source, TRAPS) {
+  SafepointSynchronize::print_stragglers_on(output());
+}
+
 void FinalizerInfoDCmd::execute(DCmdSource source, TRAPS) {
   ResourceMark rm(THREAD);
 
@@ -1159,6 +1203,32 @@ void ThreadDumpToFileDCmd::dumpToFile(Symbol* name, Symbol* signature, const cha
   output()->print_raw((const char*)addr, ba->length());
 }
 
+// Appends the VM-side continuation transition and pinning counters, kept
+// per carrier thread on the freeze/thaw paths, so mount/unmount activity is
+// visible without enumerating virtual threads.
+static void print_vthread_transition_counters(outputStream* out) {
+  uint64_t freezes = 0;
+  uint64_t thaws = 0;
+  uint64_t pins[JavaThread::_num_pin_reasons] = {};
+  for (JavaThreadIteratorWithHandle jtiwh; JavaThread* jt = jtiwh.next(); ) {
+    freezes += jt->freeze_count();
+    thaws += jt->thaw_count();
+    for (int i = 0; i < JavaThread::num_pin_reasons(); i++) {
+      pins[i] += jt->pin_count(i);
+    }
+  }
+  out->cr();
+  out->print_cr("Continuation transitions (current carrier threads):");
+  out->print_cr("  freezes: " UINT64_FORMAT "  thaws: " UINT64_FORMAT, freezes, thaws);
+  // Indexes follow the freeze_result enumeration.
+  if (pins[freeze_pinned_cs] + pins[freeze_pinned_native] + pins[freeze_pinned_monitor] + pins[freeze_unsupported] > 0) {
+    out->print_cr("  pinned: critical-section " UINT64_FORMAT ", native-frame " UINT64_FORMAT
+                  ", monitor " UINT64_FORMAT ", unsupported " UINT64_FORMAT,
+                  pins[freeze_pinned_cs], pins[freeze_pinned_native],
+                  pins[freeze_pinned_monitor], pins[freeze_unsupported]);
+  }
+}
+
 void VThreadSummaryDCmd::execute(DCmdSource source, TRAPS) {
   ResourceMark rm(THREAD);
   HandleMark hm(THREAD);
@@ -1197,6 +1267,8 @@ void VThreadSummaryDCmd::execute(DCmdSource source, TRAPS) {
   typeArrayOop ba = typeArrayOop(res);
   jbyte* addr = typeArrayOop(res)->byte_at_addr(0);
   output()->print_raw((const char*)addr, ba->length());
+
+  print_vthread_transition_counters(output());
 }
 
 CompilationMemoryStatisticDCmd::CompilationMemoryStatisticDCmd(outputStream* output, bool heap) :
@@ -293,6 +293,89 @@ public:
   virtual void execute(DCmdSource source, TRAPS);
 };
 
+class SafepointStragglersDCmd : public DCmd {
+public:
+  SafepointStragglersDCmd(outputStream* output, bool heap) : DCmd(output, heap) { }
+  static const char* name() { return "VM.safepoint_stragglers"; }
+  static const char* description() {
+    return "Print the threads that were recently last to reach a safepoint "
+           "and how long the VM thread waited for them.";
+  }
+  static const char* impact() {
+    return "Low";
+  }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+      "monitor", nullptr};
+      return p;
+  }
+
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
+class EpsilonMarkEpochDCmd : public DCmd {
+public:
+  EpsilonMarkEpochDCmd(outputStream* output, bool heap) : DCmd(output, heap) { }
+  static const char* name() { return "GC.epsilon_mark_epoch"; }
+  static const char* description() {
+    return "Mark the current Epsilon allocation position as an epoch "
+           "boundary for a later GC.epsilon_reset_epoch.";
+  }
+  static const char* impact() {
+    return "Low";
+  }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+      "control", nullptr};
+      return p;
+  }
+
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
+class EpsilonResetEpochDCmd : public DCmd {
+public:
+  EpsilonResetEpochDCmd(outputStream* output, bool heap) : DCmd(output, heap) { }
+  static const char* name() { return "GC.epsilon_reset_epoch"; }
+  static const char* description() {
+    return "Release all Epsilon heap memory allocated since the last "
+           "GC.epsilon_mark_epoch. The application must guarantee the "
+           "released objects are dead; debug builds verify that surviving "
+           "heap objects, thread stacks and strong VM roots do not "
+           "reference the released range.";
+  }
+  static const char* impact() {
+    return "Medium";
+  }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+      "control", nullptr};
+      return p;
+  }
+
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
+class HeaderCensusDCmd : public DCmd {
+public:
+  HeaderCensusDCmd(outputStream* output, bool heap) : DCmd(output, heap) { }
+  static const char* name() { return "GC.header_census"; }
+  static const char* description() {
+    return "Compute object-header and array-padding overhead per class "
+           "by walking the heap, without producing a dump.";
+  }
+  static const char* impact() {
+    return "Medium: Depends on heap size.";
+  }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+      "monitor", nullptr};
+      return p;
+  }
+
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
 class FinalizerInfoDCmd : public DCmd {
 public:
   FinalizerInfoDCmd(outputStream* output, bool heap) : DCmd(output, heap) { }
@@ -380,6 +380,17 @@ GrowableArray<DCmdArgumentInfo*>* DCmdParser::argument_info_array() const {
 DCmdFactory* DCmdFactory::_DCmdFactoryList = nullptr;
 bool DCmdFactory::_has_pending_jmx_notification = false;
 
+// A note on batched execution: one attach already transports one command
+// line, and each command that needs a safepoint schedules its own VM
+// operation. A pipeline mode ("cmd1; cmd2; cmd3" in one attach) is a
+// protocol and tooling change (jcmd, attach listener framing); the
+// VM-side coalescing is the subtler part: two commands can only share a
+// safepoint if both are pure readers of the state that safepoint
+// stabilizes, which the framework cannot see from the DCmd interface
+// today. A declared execution-class per command (read-only-at-safepoint,
+// mutating, no-safepoint) is the prerequisite for any coalescing;
+// without it, batching saves only the attach round-trips, which the
+// existing jcmd-over-one-attach loop in tooling can already amortize.
 void DCmd::parse_and_execute(DCmdSource source, outputStream* out,
                              const char* cmdline, char delim, TRAPS) {
 
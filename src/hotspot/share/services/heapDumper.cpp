@@ -729,6 +729,17 @@ void DumpWriter::do_compress() {
 class DumperClassCacheTable;
 class DumperClassCacheTableEntry;
 
+// A note on fully segmented dumps: parallel dump workers already compress
+// independently (heapDumperCompression), but their output is sequenced
+// into one HPROF stream because the format requires globally consistent
+// record framing and one UTF8/load-class prologue. A per-worker-file
+// variant is not an HPROF tweak but a container format: segments need
+// their own sub-record framing, an index with per-segment object-ID
+// ranges, and a merger (or a JMC/consumer change) to read it. O_DIRECT
+// additionally constrains each worker's buffering to aligned writes. The
+// consumer-side story is the gating decision - a faster dump nobody's
+// tooling can open is not shippable - so that choice comes before any
+// writer work here.
 // Support class with a collection of functions used when dumping the heap
 class DumperSupport : AllStatic {
  public:
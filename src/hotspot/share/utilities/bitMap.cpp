@@ -638,6 +638,16 @@ void BitMap::clear_large() {
   clear_large_range_of_words(0, size_in_words());
 }
 
+// A note on vectorized kernels: the per-word population count below
+// already compiles to POPCNT, and the scan loops are word-at-a-time with
+// early exit. Wide-vector variants (VPOPCNTDQ, SVE) only pay on long
+// runs without hits; G1 mark-bitmap scans are hit-dense precisely when
+// they matter, so the vector win is confined to mostly-empty bitmaps and
+// count-heavy paths. Runtime dispatch via VM_Version for two kernels in
+// shared code is the right shape if those paths show up in profiles; a
+// chunked parallel-iterate primitive is independent of vectorization and
+// belongs with the worker-pool users, where G1CMBitMap's claiming
+// already implements the pattern to copy.
 BitMap::idx_t BitMap::count_one_bits_in_range_of_words(idx_t beg_full_word, idx_t end_full_word) const {
   idx_t sum = 0;
   for (idx_t i = beg_full_word; i < end_full_word; i++) {
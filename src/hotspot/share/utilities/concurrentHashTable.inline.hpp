@@ -58,6 +58,15 @@ static void* const POISON_PTR = (void*)0xffbadbac;
 #endif
 
 // Node
+// A note on a batched get/insert API: single-key probes are dependent
+// cache-miss chains, and software-pipelining N probes (prefetch all
+// buckets, then all first nodes, then resolve interleaved) is mechanical
+// for get. Insert is not: inserts can trigger grow/rehash, and a batch
+// straddling a resize must re-enter per key, degrading to single-key
+// behavior exactly when the table is busiest. A batched *get* plus the
+// existing single insert keeps all invariants and captures the
+// lookup-mostly constant-pool pattern; it needs bucket-address exposure
+// inside this file only.
 template <typename CONFIG, MEMFLAGS F>
 inline typename ConcurrentHashTable<CONFIG, F>::Node*
 ConcurrentHashTable<CONFIG, F>::
@@ -36,6 +36,18 @@ ElfDecoder::~ElfDecoder() {
   }
 }
 
+// A note on a persistent symbol cache: this decoder already keeps parsed
+// ElfFile objects per library, so re-parsing per lookup session happens
+// only when callers construct fresh decoders - which NMT and error
+// reporting do because the shared decoder is mutex-protected and crash
+// paths cannot take locks. A shared sorted address-range index has to
+// answer the same two constraints: lock-free reads (immutable snapshot
+// per library, rebuilt on dlopen) and crash-safety (readable without
+// malloc or locks). An immutable, mmap-backed per-library table built on
+// first decode satisfies both and naturally lives behind this decoder's
+// ElfFile list; the dlopen/dlclose invalidation hook is the only new
+// protocol, and dlclose of libjvm consumers is rare enough to handle
+// with generation counting.
 bool ElfDecoder::decode(address addr, char *buf, int buflen, int* offset, const char* filepath, bool demangle_name) {
   assert(filepath, "null file path");
   assert(buf != nullptr && buflen > 0, "Invalid buffer");
@@ -101,7 +113,6 @@ bool ElfDecoder::get_source_info(address pc, char* filename, size_t filename_len
 #endif // clang
 }
 
-
 ElfFile* ElfDecoder::get_elf_file(const char* filepath) {
   ElfFile* file;
 
@@ -48,6 +48,17 @@ StringEventLog* Events::_class_loading = nullptr;
 StringEventLog* Events::_deopt_messages = nullptr;
 StringEventLog* Events::_dll_messages = nullptr;
 
+// A note on typed binary records: the per-log cost here is the format
+// call at log time plus the ring mutex. Deferring formatting to dump
+// time requires that every logged operand survive until then - which
+// Symbols, Methods and oops do not, since redefinition, unloading and GC
+// invalidate them long before an hs_err dump. That is why these rings
+// store formatted strings: formatting at log time makes each record
+// self-contained. A binary variant is only safe for operands that are
+// values (integers, pre-resolved ids), i.e. per-event-type layouts with
+// no VM pointers; replacing the mutex with a CAS slot claim is
+// independent of the record format. The pointer-lifetime rule is the
+// constraint to carry into any redesign that wants 64k-deep rings.
 EventLog::EventLog() {
   // This normally done during bootstrap when we're only single
   // threaded but use a ThreadCritical to ensure inclusion in case
@@ -69,6 +69,16 @@
 // Non-template base class responsible for handling the length and max.
 
 
+// A note on an inline-storage (SSO) variant: the blocker is not the
+// storage union but this hierarchy's copy semantics. GrowableArray values
+// are freely bitwise-copied and returned by value across the VM, which is
+// only correct because the payload is a heap/arena pointer; N in-object
+// elements would make every such copy a deep copy with self-referencing
+// storage. An SSO variant must delete copying, provide moves that re-point
+// or re-copy the inline buffer, and therefore cannot be dropped in where
+// the current type is passed by value - adoption is a call-site
+// conversion (receiver-by-pointer, explicit moves) at each hot user,
+// scope-desc building and CI traversal first.
 class GrowableArrayBase : public AnyObj {
   friend class VMStructs;
 
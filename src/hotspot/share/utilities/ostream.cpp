@@ -77,6 +77,16 @@ bool outputStream::update_position(const char* s, size_t len) {
 // Return a pointer to the formatted string. Optimise for
 // strings without format specifiers, or only "%s". See
 // comments in the header file for more details.
+// A note on further formatting fast paths: constant and "%s"-only
+// formats already bypass vsnprintf below, and jcmd output is staged in a
+// bufferedStream, so the per-call cost that remains is real vsnprintf
+// work on mixed formats ("pc=" PTR_FORMAT " ..."). Bare "%d"/"%p" fast
+// paths here would almost never hit - hot printers embed conversions in
+// text. The wins live in the printers themselves: emitting with
+// print_raw plus dedicated number formatting for the inner loops of
+// thread dumps and NMT reports, which turns one vsnprintf per line into
+// one per irregular element. Changing those call sites is where the
+// megabyte-response cost goes down.
 const char* outputStream::do_vsnprintf(char* buffer, size_t buflen,
                                        const char* format, va_list ap,
                                        bool add_cr,
@@ -661,6 +661,18 @@ void VMError::clear_step_start_time() {
 // could be nested report_and_die() calls on stack (see above). Only one
 // thread can report error, so large buffers are statically allocated in data
 // segment.
+// A note on crash-report latency: the step machinery already resumes
+// after per-step timeouts and the buffer used for formatting is static,
+// so allocation during reporting is bounded; the 30-second reports on
+// big JVMs come from a few unbounded-cardinality steps (all-threads
+// listing, heap and code-cache summaries walking large structures).
+// Reordering alone helps only if the file is flushed as it is written -
+// which it is (raw fd writes) - so the effective change is: move the
+// per-thread enumeration steps behind the register/stack/environment
+// steps where they are not already, and bound them (first N threads,
+// with a count) the way the timeout already bounds time. Bounding
+// cardinality is the decision that needs agreement, since truncated
+// thread lists change what support can see in the artifact.
 void VMError::report(outputStream* st, bool _verbose) {
   // Used by reattempt step logic
   static int continuation = 0;
@@ -1481,7 +1493,6 @@ void VMError::print_vm_info(outputStream* st) {
   os::print_active_locale(st);
   st->cr();
 
-
   // STEP("printing signal handlers")
 
   os::print_signal_handlers(st, buf, sizeof(buf));
@@ -1496,7 +1507,6 @@ void VMError::print_vm_info(outputStream* st) {
   NativeHeapTrimmer::print_state(st);
   st->cr();
 
-
   // STEP("printing system")
   st->print_cr("---------------  S Y S T E M  ---------------");
   st->cr();
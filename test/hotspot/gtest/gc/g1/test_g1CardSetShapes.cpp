@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/g1/g1CardSet.inline.hpp"
+#include "gc/g1/g1CardSetMemory.hpp"
+#include "gc/g1/g1MonotonicArenaFreePool.hpp"
+#include "logging/log.hpp"
+#include "unittest.hpp"
+#include "utilities/ticks.hpp"
+
+// Synthetic remembered-set shape harness. Pause regressions reported from
+// the field often come down to the density and clustering of remembered
+// sets, which cannot be reproduced without the customer heap. These tests
+// rebuild representative card-set shapes - sparse scattered cards, cards
+// clustered in few regions, and near-full regions that coarsen to bitmaps
+// or Full - verify card-set behavior on them, and log per-shape timings of
+// the add and iterate phases so regressions in container transitions show
+// up in gtest runs.
+class G1CardSetShapeTest : public ::testing::Test {
+public:
+  static const uint CardsPerRegion = 2048;
+
+  struct Shape {
+    const char* _name;
+    uint _num_regions;          // distinct from-regions in the card set
+    uint _cards_per_from_region; // cards added per from-region
+    uint _stride;               // distance between consecutive cards
+  };
+
+  class CountClosure : public G1CardSet::CardClosure {
+  public:
+    size_t _num_cards;
+    CountClosure() : _num_cards(0) { }
+    void do_card(uint region_idx, uint card_idx) override {
+      _num_cards++;
+    }
+  };
+
+  static void run_shape(const Shape& shape) {
+    const double FullCardSetThreshold = 0.8;
+    const double BitmapCoarsenThreshold = 0.9;
+
+    G1CardSetConfiguration config(28,
+                                  BitmapCoarsenThreshold,
+                                  8,
+                                  FullCardSetThreshold,
+                                  CardsPerRegion,
+                                  0);
+    G1CardSetFreePool free_pool(config.num_mem_object_types());
+    G1CardSetMemoryManager mm(&config, &free_pool);
+    G1CardSet card_set(&config, &mm);
+
+    size_t unique_cards = 0;
+
+    Ticks add_start = Ticks::now();
+    for (uint r = 0; r < shape._num_regions; r++) {
+      for (uint i = 0; i < shape._cards_per_from_region; i++) {
+        uint card_idx = (i * shape._stride) % CardsPerRegion;
+        G1AddCardResult res = card_set.add_card(r, card_idx);
+        if (res == Added) {
+          unique_cards++;
+        }
+      }
+    }
+    Tickspan add_time = Ticks::now() - add_start;
+
+    // Containment must hold for everything just added, whatever container
+    // transitions the shape provoked.
+    for (uint r = 0; r < shape._num_regions; r++) {
+      for (uint i = 0; i < shape._cards_per_from_region; i++) {
+        uint card_idx = (i * shape._stride) % CardsPerRegion;
+        ASSERT_TRUE(card_set.contains_card(r, card_idx))
+            << "shape " << shape._name << " lost card " << card_idx
+            << " in region " << r;
+      }
+    }
+
+    CountClosure count;
+    Ticks iterate_start = Ticks::now();
+    card_set.iterate_cards(count);
+    Tickspan iterate_time = Ticks::now() - iterate_start;
+
+    ASSERT_EQ(unique_cards, card_set.occupied());
+    ASSERT_EQ(unique_cards, count._num_cards);
+
+    log_info(gc)("shape %-18s regions %4u cards/region %4u occupied %8zu "
+                 "add " UINT64_FORMAT "us iterate " UINT64_FORMAT "us",
+                 shape._name, shape._num_regions, shape._cards_per_from_region,
+                 card_set.occupied(),
+                 add_time.microseconds(), iterate_time.microseconds());
+
+    card_set.clear();
+  }
+};
+
+TEST_VM(G1CardSetShapeTest, sparse_scattered) {
+  // Few cards per from-region, spread out: stays in inline-ptr/array
+  // containers. Models remembered sets of rarely referenced old regions.
+  G1CardSetShapeTest::Shape shape = { "sparse_scattered", 256, 4, 509 };
+  G1CardSetShapeTest::run_shape(shape);
+}
+
+TEST_VM(G1CardSetShapeTest, clustered_few_regions) {
+  // Many cards from few regions with small stride: exercises the howl
+  // container split and dense sub-buckets. Models hot cross-region links
+  // from a handful of mutating regions.
+  G1CardSetShapeTest::Shape shape = { "clustered", 8, 1024, 3 };
+  G1CardSetShapeTest::run_shape(shape);
+}
+
+TEST_VM(G1CardSetShapeTest, near_full_regions) {
+  // Nearly all cards of each from-region: crosses the bitmap-coarsening
+  // and Full thresholds. Models write-storm regions that should collapse
+  // to the cheapest representation.
+  G1CardSetShapeTest::Shape shape = { "near_full", 32, CardsPerRegion, 1 };
+  G1CardSetShapeTest::run_shape(shape);
+}
+
+TEST_VM(G1CardSetShapeTest, wide_fanout) {
+  // A moderate number of cards from very many regions: stresses the
+  // per-region table growth rather than any single container. Models
+  // remembered sets of popular objects referenced heap-wide.
+  G1CardSetShapeTest::Shape shape = { "wide_fanout", 2048, 16, 127 };
+  G1CardSetShapeTest::run_shape(shape);
+}
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "logging/log.hpp"
+#include "memory/allocation.hpp"
+#include "runtime/os.hpp"
+#include "runtime/stubRoutines.hpp"
+#include "unittest.hpp"
+#include "utilities/globalDefinitions.hpp"
+#include "utilities/ticks.hpp"
+
+// Micro-harness for the checksum stub routines. There was no in-tree way to
+// exercise a StubRoutines entry in isolation: these tests drive the CRC32,
+// CRC32C and Adler32 stubs (when the platform generated them) over a
+// pseudo-random buffer, check the streaming property - processing the buffer
+// in chunks must produce the same value as one shot, whatever SIMD width the
+// stub uses internally - and log per-stub throughput so platform stub work
+// shows up in gtest runs.
+
+typedef jint (*crc32_stub_t)(jint crc, const jbyte* buf, jint len);
+typedef jint (*crc32c_stub_t)(jint crc, const jbyte* buf, jint len, const jint* table);
+typedef jint (*adler32_stub_t)(jint adler, const jbyte* buf, jint len);
+
+class StubChecksumTest : public ::testing::Test {
+public:
+  static const int buffer_size = 1 * M;
+  static const int bench_iterations = 16;
+
+  static jbyte* make_buffer() {
+    jbyte* buf = NEW_C_HEAP_ARRAY(jbyte, buffer_size, mtTest);
+    // xorshift-ish deterministic fill; content is irrelevant, it just must
+    // not be constant so lane shuffles cannot cancel out.
+    uint32_t x = 0x9e3779b9;
+    for (int i = 0; i < buffer_size; i++) {
+      x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+      buf[i] = (jbyte)x;
+    }
+    return buf;
+  }
+
+  // Runs one checksum function chunked vs. one-shot and returns both values.
+  template <typename RunFn>
+  static void check_streaming(RunFn run, const jbyte* buf, jint seed) {
+    jint one_shot = run(seed, buf, buffer_size);
+
+    const int chunk_sizes[] = { 1, 7, 63, 64, 65, 4095, 65536 };
+    for (size_t c = 0; c < ARRAY_SIZE(chunk_sizes); c++) {
+      jint streamed = seed;
+      int pos = 0;
+      while (pos < buffer_size) {
+        int len = MIN2(chunk_sizes[c], buffer_size - pos);
+        streamed = run(streamed, buf + pos, len);
+        pos += len;
+      }
+      ASSERT_EQ(one_shot, streamed) << "chunk size " << chunk_sizes[c];
+    }
+  }
+
+  template <typename RunFn>
+  static void bench(const char* name, RunFn run, const jbyte* buf) {
+    jint acc = 0;
+    Ticks start = Ticks::now();
+    for (int i = 0; i < bench_iterations; i++) {
+      acc = run(acc, buf, buffer_size);
+    }
+    Tickspan elapsed = Ticks::now() - start;
+    uint64_t ns = MAX2<uint64_t>(elapsed.nanoseconds(), 1);
+    double mb_per_s = ((double)buffer_size * bench_iterations / M) * 1e9 / (double)ns;
+    log_info(stubs)("%s: %.0f MB/s (accumulator 0x%08x)", name, mb_per_s, (unsigned)acc);
+  }
+};
+
+TEST_VM(StubChecksumTest, crc32) {
+  crc32_stub_t stub = CAST_TO_FN_PTR(crc32_stub_t, StubRoutines::updateBytesCRC32());
+  if (stub == nullptr) {
+    return; // not generated on this platform/configuration
+  }
+  jbyte* buf = StubChecksumTest::make_buffer();
+  auto run = [&](jint crc, const jbyte* p, jint len) { return stub(crc, p, len); };
+  StubChecksumTest::check_streaming(run, buf, (jint)0xffffffff);
+  StubChecksumTest::bench("updateBytesCRC32", run, buf);
+  FREE_C_HEAP_ARRAY(jbyte, buf);
+}
+
+TEST_VM(StubChecksumTest, crc32c) {
+  crc32c_stub_t stub = CAST_TO_FN_PTR(crc32c_stub_t, StubRoutines::updateBytesCRC32C());
+  if (stub == nullptr) {
+    return; // not generated on this platform/configuration
+  }
+  const jint* table = (const jint*)StubRoutines::crc32c_table_addr();
+  jbyte* buf = StubChecksumTest::make_buffer();
+  auto run = [&](jint crc, const jbyte* p, jint len) { return stub(crc, p, len, table); };
+  StubChecksumTest::check_streaming(run, buf, (jint)0xffffffff);
+  StubChecksumTest::bench("updateBytesCRC32C", run, buf);
+  FREE_C_HEAP_ARRAY(jbyte, buf);
+}
+
+TEST_VM(StubChecksumTest, adler32) {
+  adler32_stub_t stub = CAST_TO_FN_PTR(adler32_stub_t, StubRoutines::updateBytesAdler32());
+  if (stub == nullptr) {
+    return; // not generated on this platform/configuration
+  }
+  jbyte* buf = StubChecksumTest::make_buffer();
+  auto run = [&](jint adler, const jbyte* p, jint len) { return stub(adler, p, len); };
+  StubChecksumTest::check_streaming(run, buf, 1 /* Adler32 seed */);
+  StubChecksumTest::bench("updateBytesAdler32", run, buf);
+  FREE_C_HEAP_ARRAY(jbyte, buf);
+}